@@ -34,19 +34,48 @@
 #include "Traits.h"
 #include "Input.h"
 #include "ScriptInterface.h"
+#include "Texture.h"
 
 namespace Rml {
 
 class Stream;
 class ContextInstancer;
 class ElementDocument;
+class ElementUtilities;
 class EventListener;
+class Geometry;
+class GeometryArena;
 class RenderInterface;
 class DataModel;
 class DataModelConstructor;
 class DataTypeRegister;
+class ElementDecoration;
+class ElementImage;
+class RenderCommandRecorder;
 enum class EventId : uint16_t;
 
+/**
+	A raw input event, used for submitting a batch of input to a context through Context::ProcessInputEvents().
+ */
+struct InputEvent {
+	enum class Type { MouseMove, MouseButtonDown, MouseButtonUp, MouseWheel, KeyDown, KeyUp, TextInput };
+
+	Type type = Type::MouseMove;
+	// The state of key modifiers, generated by ORing together members of the Input::KeyModifier enumeration.
+	int key_modifier_state = 0;
+
+	// The mouse cursor position for mouse moves, in window-coordinates.
+	Vector2i mouse_position = Vector2i(0, 0);
+	// The button index for mouse button events.
+	int button_index = 0;
+	// The mouse-wheel movement for mouse wheel events.
+	float wheel_delta = 0.f;
+	// The key for key events.
+	Input::KeyIdentifier key_identifier = Input::KI_UNKNOWN;
+	// The UTF-8 string for text input events.
+	String text;
+};
+
 /**
 	A context for storing, rendering and processing RML documents. Multiple contexts can exist simultaneously.
 
@@ -87,6 +116,75 @@ public:
 	/// Renders all visible elements in the context's documents.
 	bool Render();
 
+	/// Enable or disable parallel style matching for this context.
+	/// When enabled, Update() matches the style sheet selectors of elements in parallel whenever a large number of them need
+	/// new style definitions, such as after a style sheet or media query change. The jobs are run using SystemInterface::RunJobs().
+	/// @param[in] enable True to enable parallel style matching, false to match every element on the calling thread.
+	void EnableParallelStyleMatching(bool enable);
+	/// Returns true if parallel style matching is enabled for this context.
+	bool IsParallelStyleMatchingEnabled() const;
+
+	/// Enable or disable retained rendering for this context.
+	/// When enabled, Render() records all draw calls into a command list which is submitted through RenderInterface::RenderCommands().
+	/// The recorded list is reused on subsequent frames until the context changes. Elements which render content that changes
+	/// outside of the update loop should call Element::DirtyUpdate() or DirtyRenderCommands() to have their changes picked up.
+	/// @param[in] enable True to enable retained rendering, false to render every draw call immediately.
+	void EnableRetainedRendering(bool enable);
+	/// Returns true if retained rendering is enabled for this context.
+	bool IsRetainedRenderingEnabled() const;
+	/// Marks the recorded render commands as outdated, they will be recorded again during the next call to Render().
+	void DirtyRenderCommands();
+
+	/// Enable or disable the geometry arena for this context.
+	/// When enabled, the vertices and indices of geometry rendered in this context are moved into large, shared slabs
+	/// instead of being stored in separate allocations per geometry. Geometry is moved back out of the arena whenever it
+	/// is modified. Geometry already in the arena remains there after disabling it, until it is modified or destroyed.
+	/// @param[in] enable True to enable the geometry arena, false to keep the geometry in separate allocations.
+	void EnableGeometryArena(bool enable);
+	/// Returns true if the geometry arena is enabled for this context.
+	bool IsGeometryArenaEnabled() const;
+
+	/// Sets the time budget for updating the data models of this context during Update().
+	/// The models are updated from their outermost elements and inwards. When the budget is exceeded, the remaining views are
+	/// deferred to the next update, except for structural views such as 'data-for' which are always updated. Views are deferred
+	/// for at most one update. Update statistics are available through DataModelHandle::GetStatistics().
+	/// @param[in] budget The time budget in seconds, or zero to update all views during every update.
+	void SetDataModelUpdateBudget(double budget);
+	/// Returns the time budget for updating the data models of this context, in seconds.
+	double GetDataModelUpdateBudget() const;
+
+	/// Enable or disable asynchronous texture loading for this context.
+	/// When enabled, textures loaded from file through this context's render interface are decoded on a background thread
+	/// using RenderInterface::DecodeTexture(), and generated at the start of Update() within the texture upload budget.
+	/// Geometry using a texture is not rendered until the texture is available. Images and decorators depending on the
+	/// dimensions of a texture are laid out again once it is loaded, and a 'load' event is dispatched on their element.
+	/// Textures are loaded asynchronously for every context sharing the render interface while any of them has it enabled,
+	/// each context then generates the decoded textures within its own budget. Once disabled for all of them, pending loads
+	/// are cancelled and the waiting elements are laid out again, with their textures loaded when first used.
+	/// @param[in] enable True to enable asynchronous texture loading, false to load textures when first used.
+	void EnableAsyncTextureLoading(bool enable);
+	/// Returns true if asynchronous texture loading is enabled for this context.
+	bool IsAsyncTextureLoadingEnabled() const;
+
+	/// Sets the time budget for generating asynchronously loaded textures during Update().
+	/// @param[in] budget The time budget in seconds, or zero to generate all decoded textures during every update.
+	void SetTextureUploadBudget(double budget);
+	/// Returns the time budget for generating asynchronously loaded textures, in seconds.
+	double GetTextureUploadBudget() const;
+
+	/// Returns the region of the context whose rendered output has changed since the last call to Render(). The region
+	/// is complete after calling Update(). Backends may restrict rendering to this region, or skip the frame entirely.
+	/// @param[out] origin The top-left corner of the region, in pixels.
+	/// @param[out] dimensions The size of the region, in pixels.
+	/// @return True if anything has changed, false if the previously rendered frame is still valid.
+	bool GetDamageRegion(Vector2i& origin, Vector2i& dimensions) const;
+	/// Marks a region of the context as changed, it will be included in the damage region until the next call to Render().
+	/// @param[in] origin The top-left corner of the region, in pixels.
+	/// @param[in] dimensions The size of the region, in pixels.
+	void DirtyDamageRegion(Vector2f origin, Vector2f dimensions);
+	/// Marks the whole context as changed.
+	void DirtyDamageRegion();
+
 	/// Creates a new, empty document and places it into this context.
 	/// @param[in] instancer_name The name of the instancer used to create the document.
 	/// @return The new document, or nullptr if no document could be created.
@@ -208,6 +306,14 @@ public:
 	/// @return True if the event was not consumed (ie, was prevented from propagating by an element), false if it was.
 	bool ProcessMouseWheel(float wheel_delta, int key_modifier_state);
 
+	/// Sends a batch of input events into this context, such as all the input received during a frame.
+	/// Consecutive mouse moves are coalesced into a single move to the last position, and consecutive mouse wheel events
+	/// into a single event with their summed delta, as long as they share the same key modifier state. Thus, the hover
+	/// chain is updated once for every run of mouse moves. All other events are processed in order.
+	/// @param[in] events The input events in the order they were received.
+	/// @return True if the mouse is not interacting with any elements in the context after processing the events (see 'IsMouseInteracting'), otherwise false.
+	bool ProcessInputEvents(const Vector<InputEvent>& events);
+
 	/// Returns a hint on whether the mouse is currently interacting with any elements in this context, based on previously submitted 'ProcessMouse...()' commands.
 	/// @note Interaction is determined irrespective of background and opacity. See the RCSS property 'pointer-events' to disable interaction for specific elements.
 	/// @return True if the mouse hovers over or has activated an element in this context, otherwise false.
@@ -330,6 +436,41 @@ private:
 
 	UniquePtr<DataTypeRegister> data_type_register;
 
+	double data_model_update_budget;
+
+	bool parallel_style_matching;
+
+	// Asynchronous texture loading state.
+	bool async_texture_loading;
+	double texture_upload_budget;
+	// The texture load generation of the render interface when last checked, see TextureDatabase::GetAsyncLoadGeneration().
+	unsigned int texture_load_generation;
+	// Elements depending on the dimensions of textures being loaded, notified once the textures are available.
+	struct TextureLoadListener {
+		ObserverPtr<Element> element;
+		Vector<Texture> textures;
+	};
+	UnorderedMap<Element*, TextureLoadListener> texture_load_listeners;
+
+	// Retained rendering state.
+	bool retained_rendering;
+	bool render_commands_dirty;
+	bool recording_render_commands;
+	UniquePtr<RenderCommandRecorder> render_command_recorder;
+
+	// Incremented whenever element positions may have changed, invalidating the hit test grids of all stacking contexts.
+	unsigned int hit_test_generation;
+
+	// Shared with the geometry stored in it, so that the arena outlives any geometry removed from the context.
+	SharedPtr<GeometryArena> geometry_arena;
+
+	// The bounds of the changed region since the last render, empty if the bottom-right corner is not below and to the
+	// right of the top-left corner.
+	Vector2f damage_top_left;
+	Vector2f damage_bottom_right;
+	// Elements which have changed, their new area is added to the damage region at the end of the update.
+	Vector<ObserverPtr<Element>> damaged_elements;
+
 	// Internal callback for when an element is detached or removed from the hierarchy.
 	void OnElementDetach(Element* element);
 	// Internal callback for when a new element gains focus.
@@ -361,10 +502,35 @@ private:
 	// Releases all unloaded documents pending destruction.
 	void ReleaseUnloadedDocuments();
 
+	// Invalidates the hit test grids, they will be rebuilt on the next hit test.
+	void DirtyHitTestGrids();
+
+	// Notifies the element once the texture is available, if it is being loaded asynchronously. Requests the texture if
+	// it has not been used yet.
+	void AddTextureLoadListener(Element* element, const Texture& texture);
+	// Generates the asynchronously loaded textures within the budget, and notifies the elements waiting for them. When
+	// asynchronous loading is no longer enabled for the render interface, all waiting elements are laid out again.
+	void UpdateAsyncTextures();
+
+	// Returns the command recorder while render commands are being recorded, otherwise nullptr.
+	RenderCommandRecorder* GetActiveRenderCommandRecorder() const;
+
+	// Adds the area currently covered by the element to the damage region, and its new area at the end of the update.
+	void DirtyDamageRegion(Element* element);
+	// Adds the area covered by the element's boxes to the damage region. Uses the absolute offset of the previous
+	// render, unless 'update_offset' is set in which case its current offset is used.
+	void AddElementDamageRegion(Element* element, bool update_offset);
+	// Adds the area of all pending damaged elements, and clears the list.
+	void UpdateDamageRegion();
+
 	// Sends the specified event to all elements in new_items that don't appear in old_items.
 	static void SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters);
 
 	friend class Rml::Element;
+	friend class Rml::ElementDecoration;
+	friend class Rml::ElementImage;
+	friend class Rml::ElementUtilities;
+	friend class Rml::Geometry;
 	friend RMLUICORE_API Context* CreateContext(const String&, Vector2i, RenderInterface*);
 };
 
@@ -148,6 +148,8 @@ RMLUICORE_API StringList GetTextureSourceList();
 RMLUICORE_API void ReleaseTextures();
 /// Forces all compiled geometry handles generated by RmlUi to be released.
 RMLUICORE_API void ReleaseCompiledGeometry();
+/// Retrieves the number of hits and misses in the word width cache used during text layout, since initialisation.
+RMLUICORE_API void GetStringWidthCacheStatistics(int& num_hits, int& num_misses);
 
 } // namespace Rml
 
@@ -47,6 +47,15 @@ public:
 	bool IsVariableDirty(const String& variable_name);
 	void DirtyVariable(const String& variable_name);
 
+	// Dirty part of a variable by its address, eg. "items[42].count". Only views reading from this address, or from any
+	// of its parents or children, are updated. Views reading other members derived from the same data must be dirtied separately.
+	void DirtyAddress(const String& address);
+	// Dirty the elements of an array variable in the range [index_begin, index_end).
+	void DirtyArrayRange(const String& variable_name, int index_begin, int index_end);
+
+	// Returns timing and view statistics from the last update of the data model.
+	const DataModelStatistics& GetStatistics() const;
+
 	explicit operator bool() { return model; }
 
 private:
@@ -112,9 +121,11 @@ public:
 
 	// Register a transform function.
 	// A transform function modifies a variant with optional arguments. It can be called in data expressions using the pipe '|' operator.
+	// @param[in] is_pure Declares that the function always produces the same result from the same input and arguments, and has no side
+	//    effects. Then, each data expression reuses its previous result of the function while its input and arguments are unchanged.
 	// @note The transform function applies to every data model associated with the current Context.
-	void RegisterTransformFunc(const String& name, DataTransformFunc transform_func) {
-		type_register->GetTransformFuncRegister()->Register(name, std::move(transform_func));
+	void RegisterTransformFunc(const String& name, DataTransformFunc transform_func, bool is_pure = false) {
+		type_register->GetTransformFuncRegister()->Register(name, std::move(transform_func), is_pure);
 	}
 
 	explicit operator bool() { return model && type_register; }
@@ -71,12 +71,17 @@ private:
 
 class RMLUICORE_API TransformFuncRegister {
 public:
-	void Register(const String& name, DataTransformFunc transform_func);
+	// Pure functions always produce the same result from the same input and arguments.
+	void Register(const String& name, DataTransformFunc transform_func, bool is_pure = false);
 
-	bool Call(const String& name, Variant& inout_result, const VariantList& arguments) const;
+	bool Call(const String& name, Variant& inout_result, const VariantList& arguments, bool* out_is_pure = nullptr) const;
 
 private:
-	UnorderedMap<String, DataTransformFunc> transform_functions;
+	struct TransformFunc {
+		DataTransformFunc function;
+		bool is_pure;
+	};
+	UnorderedMap<String, TransformFunc> transform_functions;
 };
 
 
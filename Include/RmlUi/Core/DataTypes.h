@@ -58,5 +58,14 @@ struct DataAddressEntry {
 };
 using DataAddress = Vector<DataAddressEntry>;
 
+struct DataModelStatistics {
+	// Time spent during the last update of the data model, in seconds.
+	double update_time = 0;
+	// Number of views updated during the last update.
+	int num_views_updated = 0;
+	// Number of dirty views deferred to the next update after exceeding the data model update budget of the context.
+	int num_views_deferred = 0;
+};
+
 } // namespace Rml
 #endif
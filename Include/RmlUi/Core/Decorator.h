@@ -37,6 +37,7 @@ namespace Rml {
 
 class DecoratorInstancer;
 class Element;
+class ElementDecoration;
 class PropertyDictionary;
 class Property;
 struct Texture;
@@ -61,7 +62,8 @@ public:
 	/// @param[in] element_data The element data handle to release.
 	virtual void ReleaseElementData(DecoratorDataHandle element_data) const = 0;
 
-	/// Called to render the decorator on an element.
+	/// Called to render the decorator on an element. The element data is not regenerated when the element's opacity changes,
+	/// instead the opacity should be applied here, such as by passing it to Geometry::Render().
 	/// @param[in] element The element to render the decorator on.
 	/// @param[in] element_data The handle to the data generated by the decorator for the element.
 	virtual void RenderElement(Element* element, DecoratorDataHandle element_data) const = 0;
@@ -91,6 +93,9 @@ private:
 	// Optimized for the common case of a single texture.
 	Texture first_texture;
 	Vector< Texture > additional_textures;
+
+	// Watches the textures while they are loaded asynchronously.
+	friend class Rml::ElementDecoration;
 };
 
 } // namespace Rml
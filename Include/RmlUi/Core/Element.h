@@ -44,6 +44,7 @@ namespace Rml {
 
 class Context;
 class DataModel;
+class DataViewFor;
 class Decorator;
 class ElementInstancer;
 class EventDispatcher;
@@ -53,6 +54,7 @@ class ElementDefinition;
 class ElementDocument;
 class ElementScroll;
 class ElementStyle;
+class HitTestGrid;
 class LayoutEngine;
 class LayoutInlineBox;
 class LayoutBlockBox;
@@ -61,6 +63,7 @@ class PropertyDictionary;
 class RenderInterface;
 class StyleSheet;
 class StyleSheetContainer;
+class StyleMatchingPass;
 class TransformState;
 struct ElementMeta;
 struct StackingOrderedChild;
@@ -587,6 +590,15 @@ public:
 	/// Return the computed values of the element's properties. These values are updated as appropriate on every Context::Update.
 	const ComputedValues& GetComputedValues() const;
 
+	/// Marks the element as needing to be visited during the next update loop. Only elements marked in this way, and their
+	/// ancestors, are visited. Elements which need OnUpdate() to be called every frame should call this from OnUpdate().
+	void DirtyUpdate();
+	/// Marks the area covered by the element as changed, both before and after the next update, so that it is included in
+	/// the context's damage region. Elements which render content changing outside of their properties and layout should
+	/// call this whenever their rendered output changes.
+	/// @see Context::GetDamageRegion()
+	void DirtyDamageRegion();
+
 protected:
 	void Update(float dp_ratio, Vector2f vp_dimensions);
 	void Render();
@@ -597,7 +609,8 @@ protected:
 	/// Forces the element to generate a local stacking context, regardless of the value of its z-index property.
 	void ForceLocalStackingContext();
 
-	/// Called during the update loop after children are updated.
+	/// Called during the update loop before children are updated, only when the element has been marked for update.
+	/// @see DirtyUpdate()
 	virtual void OnUpdate();
 	/// Called during render after backgrounds, borders, decorators, but before children, are rendered.
 	virtual void OnRender();
@@ -661,6 +674,9 @@ private:
 	void DirtyStructure();
 	void UpdateStructure();
 
+	/// Moves a child element of this element in front of another of its children, or to the end of the DOM children if the adjacent element is null.
+	void MoveChildBefore(Element* child, Element* adjacent_element);
+
 	void DirtyTransformState(bool perspective_dirty, bool transform_dirty);
 	void UpdateTransformState();
 
@@ -735,6 +751,12 @@ private:
 
 	float baseline;
 
+	// Set by the layout engine when the contents of the element can be formatted independently of the rest of the
+	// document, in which case it is formatted in isolation when only its descendants' layout is dirty.
+	bool layout_boundary;
+	// The containing block the element was last formatted in, used when formatting it as a layout boundary.
+	Vector2f layout_containing_block;
+
 	// True if the element is visible and active.
 	bool visible;
 
@@ -748,8 +770,18 @@ private:
 	ElementList stacking_context;
 	bool stacking_context_dirty;
 
+	// Spatial index of the local stacking context for hit testing, built on demand by the context.
+	UniquePtr< HitTestGrid > hit_test_grid;
+
 	bool structure_dirty;
 
+	// Update state, the update loop only visits elements which are dirty or have dirty descendants.
+	bool dirty_update;
+	bool dirty_update_descendants;
+
+	// True while the element is awaiting its new area to be added to the context's damage region.
+	bool dirty_damage_region;
+
 	bool computed_values_are_default_initialized;
 
 	// Transform state
@@ -764,11 +796,15 @@ private:
 	ElementMeta* meta;
 
 	friend class Rml::Context;
+	friend class Rml::DataViewFor;
+	friend class Rml::ElementDocument;
 	friend class Rml::ElementStyle;
+	friend class Rml::HitTestGrid;
 	friend class Rml::LayoutEngine;
 	friend class Rml::LayoutBlockBox;
 	friend class Rml::LayoutInlineBox;
 	friend class Rml::ElementScroll;
+	friend class Rml::StyleMatchingPass;
 };
 
 } // namespace Rml
@@ -157,7 +157,7 @@ private:
 
 	/// Sets the dirty flag on the layout so the document will format its children before the next render.
 	void DirtyLayout() override;
-	/// Returns true if the document has been marked as needing a re-layout.
+	/// Returns true if the document, or any part of it, has been marked as needing a re-layout.
 	bool IsLayoutDirty() override;
 
 	/// Notify the document that media query related properties have changed and that stylesheets need to be re-evaluated.
@@ -172,6 +172,12 @@ private:
 	/// Updates the layout if necessary.
 	void UpdateLayout();
 
+	/// Marks the layout as dirty after a change to the given element. Only the element's nearest ancestor which is a layout
+	/// boundary will be formatted, or the whole document if there is no such ancestor.
+	void DirtyElementLayout(Element* element);
+	/// Formats the dirty layout boundaries in isolation. Returns false if the whole document needs to be formatted instead.
+	bool UpdateLayoutBoundaries();
+
 	/// Updates the position of the document based on the style properties.
 	void UpdatePosition();
 	/// Sets the dirty flag for document positioning
@@ -193,10 +199,13 @@ private:
 
 	// Is the layout dirty?
 	bool layout_dirty;
+	// Layout boundaries whose contents need to be formatted, only used while the whole layout is not dirty.
+	Vector<ObserverPtr<Element>> dirty_layout_boundaries;
 
 	bool position_dirty;
 
 	friend class Rml::Context;
+	friend class Rml::Element;
 	friend class Rml::Factory;
 
 };
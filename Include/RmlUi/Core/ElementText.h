@@ -103,6 +103,8 @@ private:
 	void GenerateGeometry(const FontFaceHandle font_face_handle);
 	// Generates the geometry for a single line of text.
 	void GenerateGeometry(const FontFaceHandle font_face_handle, Line& line);
+	// Forces the geometry to be regenerated on the next render, even if the lines are unchanged.
+	void DirtyGeometry();
 	// Generates any geometry necessary for rendering decoration (underline, strike-through, etc).
 	void GenerateDecoration(const FontFaceHandle font_face_handle);
 
@@ -110,6 +112,8 @@ private:
 
 	using LineList = Vector< Line >;
 	LineList lines;
+	// The lines used to generate the current geometry, kept while the lines are being rebuilt by layout.
+	LineList generated_lines;
 
 	bool dirty_layout_on_change;
 
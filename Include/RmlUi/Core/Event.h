@@ -39,6 +39,7 @@ namespace Rml {
 class Factory;
 class Element;
 class EventInstancer;
+class EventInstancerDefault;
 struct EventSpecification;
 
 enum class EventPhase { None, Capture = 1, Target = 2, Bubble = 4 };
@@ -124,6 +125,12 @@ protected:
 	Element* current_element = nullptr;
 
 private:
+	/// Reinitializes a released event for reuse, keeping the memory allocated by its members.
+	void Reset(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible);
+
+	/// Read the mouse screen position from the parameters, if available.
+	void InitializeMousePosition();
+
 	/// Project the mouse coordinates to the current element to enable
 	/// interacting with transformed elements.
 	void ProjectMouse(Element* element);
@@ -146,6 +153,7 @@ private:
 	EventInstancer* instancer = nullptr;
 
 	friend class Rml::Factory;
+	friend class Rml::EventInstancerDefault;
 };
 
 
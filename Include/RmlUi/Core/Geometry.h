@@ -37,6 +37,7 @@ namespace Rml {
 
 class Context;
 class Element;
+class GeometryArena;
 class RenderInterface;
 struct Texture;
 using GeometryDatabaseHandle = uint32_t;
@@ -67,7 +68,8 @@ public:
 
 	/// Attempts to compile the geometry if appropriate, then renders the geometry, compiled if it can.
 	/// @param[in] translation The translation of the geometry.
-	void Render(Vector2f translation);
+	/// @param[in] opacity Multiplier applied to the alpha of the vertex colours at render time, without regenerating or recompiling the geometry.
+	void Render(Vector2f translation, float opacity = 1.f);
 
 	/// Returns the geometry's vertices. If these are written to, Release() should be called to force a recompile.
 	/// @return The geometry's vertex array.
@@ -93,6 +95,13 @@ private:
 	// Move members from another geometry.
 	void MoveFrom(Geometry& other);
 
+	// Moves the vertices and indices into the arena of the host context, if enabled.
+	void MoveIntoArena();
+	// Moves the vertices and indices from the arena back into the local buffers.
+	void MoveOutOfArena();
+	// Gets the vertices and indices to render, moving them into the arena first if enabled. Returns false if there is no geometry.
+	bool GetRenderData(Vertex*& out_vertices, int& out_num_vertices, int*& out_indices, int& out_num_indices);
+
 	// Returns the host context's render interface.
 	RenderInterface* GetRenderInterface();
 
@@ -103,9 +112,18 @@ private:
 	Vector< int > indices;
 	const Texture* texture = nullptr;
 
+	// While stored in an arena, the local vertex and index buffers are empty.
+	SharedPtr<GeometryArena> arena;
+	int arena_handle = -1;
+
 	CompiledGeometryHandle compiled_geometry = 0;
 	bool compile_attempted = false;
 
+	// Copy of the vertices with their alpha scaled by the opacity, used while rendered translucent when the render
+	// interface can't apply the opacity to compiled geometry. Cleared on release.
+	Vector< Vertex > translucent_vertices;
+	float translucent_opacity = 1.f;
+
 	GeometryDatabaseHandle database_handle;
 };
 
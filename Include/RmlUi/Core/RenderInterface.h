@@ -39,6 +39,52 @@ namespace Rml {
 
 class Context;
 
+/**
+	A single draw call recorded into a render command list. Either refers to compiled geometry, or to a range of the
+	list's vertices and indices. Each command carries the full render state it should be drawn with.
+ */
+struct RenderCommand
+{
+	// The compiled geometry to render, or zero if the command renders the vertex and index ranges below.
+	CompiledGeometryHandle compiled_geometry = 0;
+
+	// Ranges into the vertex and index arrays of the command list. Indices are relative to the vertex offset. For translucent
+	// compiled geometry, the ranges hold a copy of the geometry with the opacity applied, used when the render interface
+	// can't apply the opacity to compiled geometry.
+	int vertex_offset = 0;
+	int num_vertices = 0;
+	int index_offset = 0;
+	int num_indices = 0;
+
+	TextureHandle texture = 0;
+	Vector2f translation;
+
+	// Multiplier for the alpha of the vertex colours of compiled geometry. Already applied to uncompiled geometry.
+	float opacity = 1.f;
+
+	bool scissor_enabled = false;
+	Vector2i scissor_origin;
+	Vector2i scissor_dimensions;
+
+	// Index into the transforms of the command list, or -1 if no transform applies.
+	int transform_index = -1;
+};
+
+/**
+	A flat list of draw calls, as recorded by a context in retained rendering mode.
+	@see Context::EnableRetainedRendering
+ */
+struct RenderCommandList
+{
+	Vector< Vertex > vertices;
+	Vector< int > indices;
+	Vector< Matrix4f > transforms;
+	Vector< RenderCommand > commands;
+
+	// Incremented every time the list is recorded anew, can be used to detect when data derived from the list is outdated.
+	int version = 0;
+};
+
 /**
 	The abstract base class for application-specific rendering implementation. Your application must provide a concrete
 	implementation of this class and install it through Rml::SetRenderInterface() in order for anything to be rendered.
@@ -76,6 +122,13 @@ public:
 	/// @param[in] geometry The application-specific compiled geometry to render.
 	/// @param[in] translation The translation to apply to the geometry.
 	virtual void RenderCompiledGeometry(CompiledGeometryHandle geometry, const Vector2f& translation);
+	/// Called by RmlUi when it wants to render application-compiled geometry with the alpha of its vertex colours multiplied
+	/// by an opacity, such as for translucent elements. Lets the compiled geometry be reused while the opacity changes.
+	/// @param[in] geometry The application-specific compiled geometry to render.
+	/// @param[in] translation The translation to apply to the geometry.
+	/// @param[in] opacity The multiplier for the alpha of the vertex colours, between zero and one.
+	/// @return True if the geometry was rendered, false if not supported. RmlUi will then render a copy of the geometry with the opacity applied through RenderGeometry() instead.
+	virtual bool RenderCompiledGeometryWithOpacity(CompiledGeometryHandle geometry, const Vector2f& translation, float opacity);
 	/// Called by RmlUi when it wants to release application-compiled geometry.
 	/// @param[in] geometry The application-specific compiled geometry to release.
 	virtual void ReleaseCompiledGeometry(CompiledGeometryHandle geometry);
@@ -96,12 +149,28 @@ public:
 	/// @param[in] source The application-defined image source, joined with the path of the referencing document.
 	/// @return True if the load attempt succeeded and the handle and dimensions are valid, false if not.
 	virtual bool LoadTexture(TextureHandle& texture_handle, Vector2i& texture_dimensions, const String& source);
+	/// Called by RmlUi on a background thread to read and decode a texture, when asynchronous texture loading is enabled for a
+	/// context using this render interface. The decoded data is later passed to GenerateTexture() on the calling thread of
+	/// Context::Update(). Must not call any other functions of the render interface. Any other interfaces used while
+	/// decoding, such as the file interface, must be safe to call from the background thread.
+	/// @param[out] data The decoded texture data. Each pixel is made up of four 8-bit values, indicating red, green, blue and alpha in that order.
+	/// @param[out] dimensions The dimensions, in pixels, of the decoded data.
+	/// @param[in] source The application-defined image source, joined with the path of the referencing document.
+	/// @return True if the texture was decoded, false if decoding is not supported or failed. RmlUi will then load the texture through LoadTexture() instead.
+	virtual bool DecodeTexture(UniquePtr<byte[]>& data, Vector2i& dimensions, const String& source);
 	/// Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
 	/// @param[out] texture_handle The handle to write the texture handle for the generated texture to.
 	/// @param[in] source The raw 8-bit texture data. Each pixel is made up of four 8-bit values, indicating red, green, blue and alpha in that order.
 	/// @param[in] source_dimensions The dimensions, in pixels, of the source data.
 	/// @return True if the texture generation succeeded and the handle is valid, false if not.
 	virtual bool GenerateTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions);
+	/// Called by RmlUi when a region of a previously generated texture has changed, such as when new glyphs are added to a font texture.
+	/// @param[in] texture_handle The handle of the texture to update.
+	/// @param[in] source The raw 8-bit texture data of the region, each pixel is made up of four 8-bit values, indicating red, green, blue and alpha in that order.
+	/// @param[in] source_dimensions The dimensions, in pixels, of the region.
+	/// @param[in] offset The position of the region's top-left corner within the texture, in pixels.
+	/// @return True if the texture was updated, false if updates are not supported. RmlUi will then regenerate the texture and its dependent geometry instead.
+	virtual bool UpdateTexture(TextureHandle texture_handle, const byte* source, const Vector2i& source_dimensions, const Vector2i& offset);
 	/// Called by RmlUi when a loaded texture is no longer required.
 	/// @param texture The texture handle to release.
 	virtual void ReleaseTexture(TextureHandle texture);
@@ -112,8 +181,15 @@ public:
 	/// @param[in] transform The new transform to apply, or nullptr if no transform applies to the current element.
 	virtual void SetTransform(const Matrix4f* transform);
 
-	/// Get the context currently being rendered. This is only valid during RenderGeometry,
-	/// CompileGeometry, RenderCompiledGeometry, EnableScissorRegion and SetScissorRegion.
+	/// Called by RmlUi to submit all draw calls of a context at once, when retained rendering is enabled for the context.
+	/// Consecutive draw calls sharing the same texture and render state have already been merged where possible. The
+	/// same list is submitted again on subsequent frames for as long as the context does not change.
+	/// The default implementation submits each command through the functions above.
+	/// @param[in] command_list The recorded draw calls with their render state.
+	virtual void RenderCommands(RenderCommandList& command_list);
+
+	/// Get the context currently being rendered. This is only valid during RenderGeometry, CompileGeometry,
+	/// RenderCompiledGeometry, RenderCompiledGeometryWithOpacity, EnableScissorRegion, SetScissorRegion and RenderCommands.
 	Context* GetContext() const;
 
 private:
@@ -90,7 +90,18 @@ public:
 	const Sprite* GetSprite(const String& name) const;
 
 	/// Returns the compiled element definition for a given element and its hierarchy.
-	SharedPtr<ElementDefinition> GetElementDefinition(const Element* element) const;
+	/// @param[in] element The element to fetch the definition for.
+	/// @param[out] structurally_volatile If set, true is written to it when the result may change with the siblings of the element or its ancestors.
+	SharedPtr<ElementDefinition> GetElementDefinition(const Element* element, bool* structurally_volatile = nullptr) const;
+
+	/// Collects the nodes applicable to the given element and its hierarchy, sorted by specificity.
+	/// This only reads from the style sheet and the element tree, and may be called concurrently as long as neither is modified.
+	/// @param[in] element The element to match.
+	/// @param[out] applicable_nodes The list to append the matching nodes to, only the appended nodes are sorted.
+	/// @param[out] structurally_volatile If set, true is written to it when the result may change with the siblings of the element or its ancestors.
+	void GetApplicableNodes(const Element* element, NodeList& applicable_nodes, bool* structurally_volatile = nullptr) const;
+	/// Returns the compiled element definition for a list of applicable nodes, as returned by GetApplicableNodes().
+	SharedPtr<ElementDefinition> GetElementDefinition(const NodeList& applicable_nodes) const;
 
 	/// Retrieve the hash key used to look-up applicable nodes in the node index.
 	static size_t NodeHash(const String& tag, const String& id);
@@ -96,6 +96,12 @@ public:
 	
 	/// Deactivate keyboard (for touchscreen devices)
 	virtual void DeactivateKeyboard();
+
+	/// Runs a number of independent jobs, possibly in parallel, and returns when all of them have completed.
+	/// The default implementation spreads the jobs over a set of temporary threads. Override to submit them to an existing job system.
+	/// @param[in] num_jobs The number of jobs to run.
+	/// @param[in] job The function to call once for every job index in the range [0, num_jobs). May be called concurrently from multiple threads.
+	virtual void RunJobs(int num_jobs, const Function<void(int)>& job);
 };
 
 } // namespace Rml
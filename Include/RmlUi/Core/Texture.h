@@ -77,6 +77,18 @@ public:
 	/// @param[in] The render interface that is requesting the dimensions.
 	/// @return The texture's dimensions. This will be (0, 0) if the texture isn't loaded.
 	Vector2i GetDimensions(RenderInterface* render_interface) const;
+	/// Returns true while the texture is being loaded asynchronously, see Context::EnableAsyncTextureLoading().
+	/// @param[in] The render interface that is loading the texture.
+	/// @return True if the texture has been requested but is not yet available, its handle and dimensions are then empty.
+	bool IsLoading(RenderInterface* render_interface) const;
+
+	/// Updates a region of the texture for every render interface which has already loaded it. Only applies to textures
+	/// set by a callback function, which must generate the updated data whenever the texture is loaded anew.
+	/// @param[in] source The RGBA data of the region.
+	/// @param[in] source_dimensions The dimensions of the region.
+	/// @param[in] offset The position of the region within the texture.
+	/// @return False if any render interface could not update the texture, in which case it needs to be regenerated.
+	bool Update(const byte* source, Vector2i source_dimensions, Vector2i offset) const;
 
 	/// Returns true if the texture points to the same underlying resource.
 	bool operator==(const Texture&) const;
@@ -87,6 +87,9 @@ void ElementGame::ProcessEvent(Rml::Event& event)
 void ElementGame::OnUpdate()
 {
 	game->Update();
+
+	// The game needs to be updated every frame.
+	DirtyUpdate();
 }
 
 // Renders the game.
@@ -82,6 +82,9 @@ void ElementGame::OnUpdate()
 {
 	game->Update();
 
+	// The game needs to be updated every frame.
+	DirtyUpdate();
+
 	if (game->IsGameOver())
 		DispatchEvent("gameover", Rml::Dictionary());
 }
@@ -60,8 +60,12 @@ public:
 
 	/// Called by RmlUi when a texture is required by the library.
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
+	/// Called by RmlUi on a background thread to decode a texture, when asynchronous texture loading is enabled.
+	bool DecodeTexture(Rml::UniquePtr<Rml::byte[]>& data, Rml::Vector2i& dimensions, const Rml::String& source) override;
 	/// Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	/// Called by RmlUi when a region of a previously generated texture has changed.
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions, const Rml::Vector2i& offset) override;
 	/// Called by RmlUi when a loaded texture is no longer required.
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
 
@@ -39,10 +39,18 @@
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "DataModel.h"
+#include "ElementDecoration.h"
 #include "EventDispatcher.h"
+#include "GeometryArena.h"
+#include "HitTestGrid.h"
 #include "PluginRegistry.h"
+#include "RenderCommandRecorder.h"
 #include "StreamFile.h"
+#include "StyleMatchingPass.h"
+#include "TextureDatabase.h"
+#include "TransformState.h"
 #include <algorithm>
+#include <float.h>
 #include <iterator>
 
 
@@ -84,6 +92,23 @@ Context::Context(const String& name) : name(name), dimensions(0, 0), density_ind
 	last_click_element = nullptr;
 	last_click_time = 0;
 	last_click_mouse_position = Vector2i(0, 0);
+
+	data_model_update_budget = 0;
+
+	parallel_style_matching = false;
+
+	async_texture_loading = false;
+	texture_upload_budget = 0;
+	texture_load_generation = 0;
+
+	retained_rendering = false;
+	render_commands_dirty = true;
+	recording_render_commands = false;
+
+	hit_test_generation = 1;
+
+	damage_top_left = Vector2f(0, 0);
+	damage_bottom_right = Vector2f(0, 0);
 }
 
 Context::~Context()
@@ -100,6 +125,10 @@ Context::~Context()
 
 	instancer = nullptr;
 
+	// The documents are already released, so there are no elements left to notify.
+	if (async_texture_loading)
+		TextureDatabase::EnableAsyncLoading(render_interface, false);
+
 	render_interface = nullptr;
 }
 
@@ -132,6 +161,8 @@ void Context::SetDimensions(const Vector2i _dimensions)
 		}
 		
 		clip_dimensions = dimensions;
+
+		DirtyDamageRegion();
 	}
 }
 
@@ -156,6 +187,8 @@ void Context::SetDensityIndependentPixelRatio(float _density_independent_pixel_r
 				document->DirtyDpProperties();
 			}
 		}
+
+		DirtyDamageRegion();
 	}
 }
 
@@ -169,15 +202,41 @@ bool Context::Update()
 {
 	RMLUI_ZoneScoped;
 
-	// Update all data models first
+	// Generate textures loaded in the background first, so that elements depending on them are laid out during this update.
+	if (TextureDatabase::IsAsyncLoading(render_interface) || texture_load_generation != TextureDatabase::GetAsyncLoadGeneration(render_interface))
+		UpdateAsyncTextures();
+
+	// Update all data models first, sharing the update budget between them.
+	const double data_model_deadline = (data_model_update_budget > 0 ? GetSystemInterface()->GetElapsedTime() + data_model_update_budget : 0.0);
 	for (auto& data_model : data_models)
-		data_model.second->Update(true);
+		data_model.second->Update(true, data_model_deadline);
 
-	root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
+	// Anything visited by the update loop may change the rendered output.
+	if (root->dirty_update || root->dirty_update_descendants)
+	{
+		render_commands_dirty = true;
+		DirtyHitTestGrids();
+	}
+
+	if (parallel_style_matching)
+	{
+		StyleMatchingPass style_matching_pass(root.get());
+		root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
+	}
+	else
+	{
+		root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
+	}
 
 	for (int i = 0; i < root->GetNumChildren(); ++i)
 		if (auto doc = root->GetChild(i)->GetOwnerDocument())
 		{
+			if (doc->IsLayoutDirty())
+			{
+				render_commands_dirty = true;
+				DirtyHitTestGrids();
+			}
+
 			doc->UpdateLayout();
 			doc->UpdatePosition();
 		}
@@ -185,6 +244,8 @@ bool Context::Update()
 	// Release any documents that were unloaded during the update.
 	ReleaseUnloadedDocuments();
 
+	UpdateDamageRegion();
+
 	return true;
 }
 
@@ -198,20 +259,56 @@ bool Context::Render()
 		return false;
 
 	render_interface->context = this;
-	ElementUtilities::ApplyActiveClipRegion(this, render_interface);
 
-	root->Render();
+	// Start a new damage region, only elements still awaiting their update are carried over.
+	damage_top_left = Vector2f(0, 0);
+	damage_bottom_right = Vector2f(0, 0);
+	for (const ObserverPtr<Element>& element : damaged_elements)
+	{
+		if (element)
+			AddElementDamageRegion(element.get(), false);
+	}
 
-	ElementUtilities::SetClippingRegion(nullptr, this);
+	// The drag clone follows the mouse, record it every frame while it is active.
+	const bool record_commands = retained_rendering && (render_commands_dirty || drag_clone);
 
-	// Render the cursor proxy so that any attached drag clone will be rendered below the cursor.
-	if (drag_clone)
+	if (record_commands)
 	{
-		static_cast<ElementDocument&>(*cursor_proxy).UpdateDocument();
-		cursor_proxy->SetOffset(Vector2f((float)Math::Clamp(mouse_position.x, 0, dimensions.x),
-			(float)Math::Clamp(mouse_position.y, 0, dimensions.y)),
-			nullptr);
-		cursor_proxy->Render();
+		RMLUI_ZoneScopedN("RecordRenderCommands");
+
+		if (!render_command_recorder)
+			render_command_recorder = MakeUnique<RenderCommandRecorder>();
+
+		render_command_recorder->Clear();
+		recording_render_commands = true;
+		render_commands_dirty = false;
+	}
+
+	if (!retained_rendering || record_commands)
+	{
+		ElementUtilities::ApplyActiveClipRegion(this, render_interface);
+
+		root->Render();
+
+		ElementUtilities::SetClippingRegion(nullptr, this);
+
+		// Render the cursor proxy so that any attached drag clone will be rendered below the cursor.
+		if (drag_clone)
+		{
+			static_cast<ElementDocument&>(*cursor_proxy).UpdateDocument();
+			cursor_proxy->SetOffset(Vector2f((float)Math::Clamp(mouse_position.x, 0, dimensions.x),
+				(float)Math::Clamp(mouse_position.y, 0, dimensions.y)),
+				nullptr);
+			cursor_proxy->Render();
+		}
+	}
+
+	if (retained_rendering)
+	{
+		recording_render_commands = false;
+
+		RMLUI_ZoneScopedN("RenderCommands");
+		render_interface->RenderCommands(render_command_recorder->GetCommandList());
 	}
 
 	render_interface->context = nullptr;
@@ -219,6 +316,141 @@ bool Context::Render()
 	return true;
 }
 
+void Context::EnableParallelStyleMatching(bool enable)
+{
+	parallel_style_matching = enable;
+}
+
+bool Context::IsParallelStyleMatchingEnabled() const
+{
+	return parallel_style_matching;
+}
+
+void Context::EnableRetainedRendering(bool enable)
+{
+	if (retained_rendering != enable)
+	{
+		retained_rendering = enable;
+		render_commands_dirty = true;
+
+		if (!enable)
+			render_command_recorder.reset();
+	}
+}
+
+bool Context::IsRetainedRenderingEnabled() const
+{
+	return retained_rendering;
+}
+
+void Context::EnableGeometryArena(bool enable)
+{
+	if (enable && !geometry_arena)
+		geometry_arena = MakeShared<GeometryArena>();
+	else if (!enable)
+		geometry_arena.reset();
+}
+
+bool Context::IsGeometryArenaEnabled() const
+{
+	return (bool)geometry_arena;
+}
+
+void Context::SetDataModelUpdateBudget(double budget)
+{
+	data_model_update_budget = Math::Max(budget, 0.0);
+}
+
+double Context::GetDataModelUpdateBudget() const
+{
+	return data_model_update_budget;
+}
+
+void Context::EnableAsyncTextureLoading(bool enable)
+{
+	if (async_texture_loading == enable)
+		return;
+
+	async_texture_loading = enable;
+	TextureDatabase::EnableAsyncLoading(render_interface, enable);
+
+	// Pending loads are cancelled when no context has it enabled for the render interface anymore, let the waiting
+	// elements be laid out again right away.
+	if (!enable && !TextureDatabase::IsAsyncLoading(render_interface))
+		UpdateAsyncTextures();
+}
+
+bool Context::IsAsyncTextureLoadingEnabled() const
+{
+	return async_texture_loading;
+}
+
+void Context::SetTextureUploadBudget(double budget)
+{
+	texture_upload_budget = Math::Max(budget, 0.0);
+}
+
+double Context::GetTextureUploadBudget() const
+{
+	return texture_upload_budget;
+}
+
+void Context::DirtyRenderCommands()
+{
+	render_commands_dirty = true;
+	DirtyHitTestGrids();
+}
+
+void Context::DirtyHitTestGrids()
+{
+	hit_test_generation += 1;
+}
+
+bool Context::GetDamageRegion(Vector2i& origin, Vector2i& dimensions) const
+{
+	const Vector2i top_left(Math::RoundDownToInteger(damage_top_left.x), Math::RoundDownToInteger(damage_top_left.y));
+	const Vector2i bottom_right(Math::RoundUpToInteger(damage_bottom_right.x), Math::RoundUpToInteger(damage_bottom_right.y));
+
+	origin = top_left;
+	dimensions = bottom_right - top_left;
+
+	return dimensions.x > 0 && dimensions.y > 0;
+}
+
+void Context::DirtyDamageRegion(Vector2f origin, Vector2f dimensions)
+{
+	Vector2f top_left = origin;
+	Vector2f bottom_right = origin + dimensions;
+
+	// Only the visible part of the region is of interest.
+	top_left.x = Math::Max(top_left.x, 0.f);
+	top_left.y = Math::Max(top_left.y, 0.f);
+	bottom_right.x = Math::Min(bottom_right.x, float(this->dimensions.x));
+	bottom_right.y = Math::Min(bottom_right.y, float(this->dimensions.y));
+
+	if (bottom_right.x <= top_left.x || bottom_right.y <= top_left.y)
+		return;
+
+	if (damage_bottom_right.x <= damage_top_left.x || damage_bottom_right.y <= damage_top_left.y)
+	{
+		damage_top_left = top_left;
+		damage_bottom_right = bottom_right;
+	}
+	else
+	{
+		damage_top_left.x = Math::Min(damage_top_left.x, top_left.x);
+		damage_top_left.y = Math::Min(damage_top_left.y, top_left.y);
+		damage_bottom_right.x = Math::Max(damage_bottom_right.x, bottom_right.x);
+		damage_bottom_right.y = Math::Max(damage_bottom_right.y, bottom_right.y);
+	}
+}
+
+void Context::DirtyDamageRegion()
+{
+	damage_top_left = Vector2f(0, 0);
+	damage_bottom_right = Vector2f(dimensions);
+}
+
 // Creates a new, empty document and places it into this context. 
 ElementDocument* Context::CreateDocument(const String& instancer_name)
 {
@@ -568,10 +800,13 @@ bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 	GenerateMouseEventParameters(parameters, -1);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
 
+	// The drag parameters are only used while dragging, they only differ by the dragged element.
 	Dictionary drag_parameters;
-	GenerateMouseEventParameters(drag_parameters);
-	GenerateDragEventParameters(drag_parameters);
-	GenerateKeyModifierEventParameters(drag_parameters, key_modifier_state);
+	if (drag || drag_hover)
+	{
+		drag_parameters = parameters;
+		GenerateDragEventParameters(drag_parameters);
+	}
 
 	// Update the current hover chain. This will send all necessary 'onmouseout', 'onmouseover', 'ondragout' and
 	// 'ondragover' messages.
@@ -788,6 +1023,54 @@ bool Context::ProcessMouseWheel(float wheel_delta, int key_modifier_state)
 	return true;
 }
 
+bool Context::ProcessInputEvents(const Vector<InputEvent>& events)
+{
+	RMLUI_ZoneScoped;
+
+	const size_t num_events = events.size();
+	for (size_t i = 0; i < num_events; i++)
+	{
+		const InputEvent& event = events[i];
+
+		switch (event.type)
+		{
+		case InputEvent::Type::MouseMove:
+		{
+			// Only the last position of consecutive moves is needed.
+			size_t last = i;
+			while (last + 1 < num_events && events[last + 1].type == InputEvent::Type::MouseMove &&
+				events[last + 1].key_modifier_state == event.key_modifier_state)
+				last++;
+
+			const Vector2i position = events[last].mouse_position;
+			ProcessMouseMove(position.x, position.y, event.key_modifier_state);
+			i = last;
+		}
+		break;
+		case InputEvent::Type::MouseWheel:
+		{
+			float wheel_delta = event.wheel_delta;
+			while (i + 1 < num_events && events[i + 1].type == InputEvent::Type::MouseWheel &&
+				events[i + 1].key_modifier_state == event.key_modifier_state)
+			{
+				i++;
+				wheel_delta += events[i].wheel_delta;
+			}
+
+			ProcessMouseWheel(wheel_delta, event.key_modifier_state);
+		}
+		break;
+		case InputEvent::Type::MouseButtonDown: ProcessMouseButtonDown(event.button_index, event.key_modifier_state); break;
+		case InputEvent::Type::MouseButtonUp:   ProcessMouseButtonUp(event.button_index, event.key_modifier_state); break;
+		case InputEvent::Type::KeyDown:         ProcessKeyDown(event.key_identifier, event.key_modifier_state); break;
+		case InputEvent::Type::KeyUp:           ProcessKeyUp(event.key_identifier, event.key_modifier_state); break;
+		case InputEvent::Type::TextInput:       ProcessTextInput(event.text); break;
+		}
+	}
+
+	return !IsMouseInteracting();
+}
+
 bool Context::IsMouseInteracting() const
 {
 	return (hover && hover != root.get()) || (active && active != root.get());
@@ -799,6 +1082,169 @@ RenderInterface* Context::GetRenderInterface() const
 	return render_interface;
 }
 	
+void Context::AddTextureLoadListener(Element* element, const Texture& texture)
+{
+	if (!texture || !TextureDatabase::IsAsyncLoading(render_interface))
+		return;
+
+	// Request the texture now in case it has not been used yet.
+	if (texture.GetHandle(render_interface) || !texture.IsLoading(render_interface))
+		return;
+
+	TextureLoadListener& listener = texture_load_listeners[element];
+	if (!listener.element)
+	{
+		// Replace any entry left by a destroyed element at the same address.
+		listener.element = element->GetObserverPtr();
+		listener.textures.clear();
+	}
+
+	if (std::find(listener.textures.begin(), listener.textures.end(), texture) == listener.textures.end())
+		listener.textures.push_back(texture);
+}
+
+void Context::UpdateAsyncTextures()
+{
+	const bool async_loading = TextureDatabase::IsAsyncLoading(render_interface);
+	TextureDatabase::UploadAsyncTextures(render_interface, texture_upload_budget);
+
+	// Textures may also have been generated by another context sharing the render interface.
+	const unsigned int generation = TextureDatabase::GetAsyncLoadGeneration(render_interface);
+	if (generation == texture_load_generation)
+		return;
+
+	texture_load_generation = generation;
+
+	// Geometry skipped while its texture was loading can now be rendered.
+	DirtyRenderCommands();
+	DirtyDamageRegion();
+
+	// Without asynchronous loading all pending loads have been cancelled, the elements are laid out again but the
+	// textures are only loaded once used.
+	Vector<ObserverPtr<Element>> loaded_elements;
+	for (auto it = texture_load_listeners.begin(); it != texture_load_listeners.end();)
+	{
+		TextureLoadListener& listener = it->second;
+		Element* element = listener.element.get();
+
+		const size_t num_textures = listener.textures.size();
+		if (element && async_loading)
+		{
+			listener.textures.erase(std::remove_if(listener.textures.begin(), listener.textures.end(),
+				[this](const Texture& texture) { return !texture.IsLoading(render_interface); }), listener.textures.end());
+		}
+		else
+		{
+			listener.textures.clear();
+		}
+
+		if (element && listener.textures.size() != num_textures)
+		{
+			element->DirtyLayout();
+			element->GetElementDecoration()->DirtyDecorators();
+			if (async_loading)
+				loaded_elements.push_back(listener.element);
+		}
+
+		if (listener.textures.empty())
+			it = texture_load_listeners.erase(it);
+		else
+			++it;
+	}
+
+	// Events are dispatched last, as their handlers may add new listeners.
+	for (const ObserverPtr<Element>& element : loaded_elements)
+	{
+		if (element)
+			element->DispatchEvent(EventId::Load, Dictionary());
+	}
+}
+
+RenderCommandRecorder* Context::GetActiveRenderCommandRecorder() const
+{
+	return recording_render_commands ? render_command_recorder.get() : nullptr;
+}
+
+void Context::DirtyDamageRegion(Element* element)
+{
+	AddElementDamageRegion(element, false);
+	damaged_elements.push_back(element->GetObserverPtr());
+}
+
+void Context::AddElementDamageRegion(Element* element, bool update_offset)
+{
+	const Vector2f offset = (update_offset ? element->GetAbsoluteOffset(Box::BORDER) : element->absolute_offset + element->main_box.GetPosition(Box::BORDER));
+	const TransformState* transform_state = element->GetTransformState();
+	const Matrix4f* transform = (transform_state ? transform_state->GetTransform() : nullptr);
+
+	const int num_boxes = element->GetNumBoxes();
+	for (int i = 0; i < num_boxes; i++)
+	{
+		Vector2f box_offset;
+		const Box& box = element->GetBox(i, box_offset);
+		const Vector2f size = box.GetSize(Box::BORDER);
+		if (size.x <= 0.f || size.y <= 0.f)
+			continue;
+
+		Vector2f top_left = offset + box_offset;
+		Vector2f bottom_right = top_left + size;
+
+		if (transform)
+		{
+			// Project the corners of the box onto the screen. Corners behind the viewer can end up anywhere, in that
+			// case damage the whole context.
+			const Vector2f corners[4] = { top_left, Vector2f(bottom_right.x, top_left.y), bottom_right, Vector2f(top_left.x, bottom_right.y) };
+
+			top_left = Vector2f(FLT_MAX, FLT_MAX);
+			bottom_right = Vector2f(-FLT_MAX, -FLT_MAX);
+
+			for (const Vector2f& corner : corners)
+			{
+				const Vector4f projected = *transform * Vector4f(corner.x, corner.y, 0, 1);
+				if (projected.w <= 0.f)
+				{
+					DirtyDamageRegion();
+					return;
+				}
+
+				const Vector2f position(projected.x / projected.w, projected.y / projected.w);
+				top_left.x = Math::Min(top_left.x, position.x);
+				top_left.y = Math::Min(top_left.y, position.y);
+				bottom_right.x = Math::Max(bottom_right.x, position.x);
+				bottom_right.y = Math::Max(bottom_right.y, position.y);
+			}
+		}
+
+		DirtyDamageRegion(top_left, bottom_right - top_left);
+	}
+}
+
+void Context::UpdateDamageRegion()
+{
+	RMLUI_ZoneScoped;
+
+	// Elements can be marked again while adding their area, make sure we don't iterate over the list while it is modified.
+	Vector<ObserverPtr<Element>> elements;
+	elements.swap(damaged_elements);
+
+	for (ObserverPtr<Element>& element_ptr : elements)
+	{
+		Element* element = element_ptr.get();
+		if (!element)
+			continue;
+
+		element->dirty_damage_region = false;
+
+		if (element->GetContext() == this && element->IsVisible())
+			AddElementDamageRegion(element, true);
+	}
+
+	// Reuse the memory of the list.
+	elements.clear();
+	if (damaged_elements.empty())
+		damaged_elements.swap(elements);
+}
+
 // Gets the current clipping region for the render traversal
 bool Context::GetActiveClipRegion(Vector2i& origin, Vector2i& dimensions) const
 {
@@ -871,6 +1317,9 @@ bool Context::RemoveDataModel(const String& name)
 // Internal callback for when an element is removed from the hierarchy.
 void Context::OnElementDetach(Element* element)
 {
+	// The area previously covered by the element is no longer rendered.
+	AddElementDamageRegion(element, false);
+
 	auto it_hover = hover_chain.find(element);
 	if (it_hover != hover_chain.end())
 	{
@@ -1125,8 +1574,9 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 		if (element->stacking_context_dirty)
 			element->BuildLocalStackingContext();
 
-		for (int i = (int) element->stacking_context.size() - 1; i >= 0; --i)
-		{
+		Element* child_element = nullptr;
+
+		auto hit_test_child = [&](int i) {
 			if (ignore_element != nullptr)
 			{
 				Element* element_hierarchy = element->stacking_context[i];
@@ -1139,13 +1589,34 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 				}
 
 				if (element_hierarchy != nullptr)
-					continue;
+					return false;
 			}
 
-			Element* child_element = GetElementAtPoint(point, ignore_element, element->stacking_context[i]);
-			if (child_element != nullptr)
+			child_element = GetElementAtPoint(point, ignore_element, element->stacking_context[i]);
+			return child_element != nullptr;
+		};
+
+		if ((int)element->stacking_context.size() >= HitTestGrid::MinimumElements)
+		{
+			// Only test the elements whose bounds may contain the point.
+			if (!element->hit_test_grid)
+				element->hit_test_grid = MakeUnique<HitTestGrid>();
+
+			HitTestGrid& grid = *element->hit_test_grid;
+			if (!grid.IsValid(hit_test_generation))
+				grid.Build(element->stacking_context, hit_test_generation);
+
+			if (grid.ForEachCandidate(point, hit_test_child))
 				return child_element;
 		}
+		else
+		{
+			for (int i = (int)element->stacking_context.size() - 1; i >= 0; --i)
+			{
+				if (hit_test_child(i))
+					return child_element;
+			}
+		}
 	}
 
 	// Ignore elements whose pointer events are disabled.
@@ -43,6 +43,7 @@
 #include "PluginRegistry.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetParser.h"
+#include "StringWidthCache.h"
 #include "TemplateCache.h"
 #include "TextureDatabase.h"
 #include "EventSpecification.h"
@@ -161,6 +162,7 @@ void Shutdown()
 	default_font_interface.reset();
 
 	TextureDatabase::Shutdown();
+	StringWidthCache::Clear();
 
 	initialised = false;
 
@@ -348,6 +350,13 @@ StringList GetTextureSourceList()
 void ReleaseTextures()
 {
 	TextureDatabase::ReleaseTextures();
+
+	// Recorded render commands may refer to the released texture handles.
+	for (auto& name_context : contexts)
+	{
+		name_context.second->DirtyRenderCommands();
+		name_context.second->DirtyDamageRegion();
+	}
 }
 
 void ReleaseCompiledGeometry()
@@ -355,4 +364,9 @@ void ReleaseCompiledGeometry()
 	return GeometryDatabase::ReleaseAll();
 }
 
+void GetStringWidthCacheStatistics(int& num_hits, int& num_misses)
+{
+	StringWidthCache::GetStatistics(num_hits, num_misses);
+}
+
 } // namespace Rml
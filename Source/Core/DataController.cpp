@@ -69,5 +69,12 @@ void DataControllers::OnElementRemove(Element* element)
 	controllers.erase(element);
 }
 
+void DataControllers::MoveAddresses(Element* element, const DataAddressMoveList& moves)
+{
+	auto range = controllers.equal_range(element);
+	for (auto it = range.first; it != range.second; ++it)
+		it->second->MoveAddresses(moves);
+}
+
 
 } // namespace Rml
@@ -37,6 +37,8 @@ namespace Rml {
 
 class Element;
 class DataModel;
+struct DataAddressMove;
+using DataAddressMoveList = Vector<DataAddressMove>;
 
 
 class DataControllerInstancer : public NonCopyMoveable {
@@ -86,6 +88,9 @@ public:
     // @return True on success.
     virtual bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) = 0;
 
+    // Move the addresses assigned by this controller, such as when its 'data-for' entry is moved to a new index.
+    virtual void MoveAddresses(const DataAddressMoveList& /*moves*/) {}
+
     // Returns the attached element if it still exists.
     Element* GetElement() const;
 
@@ -109,6 +114,9 @@ public:
 
     void OnElementRemove(Element* element);
 
+    // Move the addresses of the controllers attached to the given element.
+    void MoveAddresses(Element* element, const DataAddressMoveList& moves);
+
 private:
     using ElementControllersMap = UnorderedMultimap<Element*, DataControllerPtr>;
     ElementControllersMap controllers;
@@ -62,6 +62,11 @@ bool DataControllerValue::Initialize(DataModel& model, Element* element, const S
 	return true;
 }
 
+void DataControllerValue::MoveAddresses(const DataAddressMoveList& moves)
+{
+	MoveDataAddress(address, moves);
+}
+
 void DataControllerValue::ProcessEvent(Event& event)
 {
 	if (Element* element = GetElement())
@@ -82,7 +87,7 @@ void DataControllerValue::ProcessEvent(Event& event)
 		if (DataVariable variable = model->GetVariable(address))
 		{
 			if (SetValue(it->second, variable))
-				model->DirtyVariable(address.front().name);
+				model->DirtyAssignedAddress(address);
 		}
 	}
 }
@@ -165,6 +170,12 @@ bool DataControllerEvent::Initialize(DataModel& model, Element* element, const S
 	return true;
 }
 
+void DataControllerEvent::MoveAddresses(const DataAddressMoveList& moves)
+{
+	if (expression)
+		expression->MoveAddresses(moves);
+}
+
 void DataControllerEvent::ProcessEvent(Event& event)
 {
 	if (!expression)
@@ -50,6 +50,8 @@ public:
 
     bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
+    void MoveAddresses(const DataAddressMoveList& moves) override;
+
 protected:
     // Responds to 'Change' events.
     void ProcessEvent(Event& event) override;
@@ -79,6 +81,8 @@ public:
 
     bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
+    void MoveAddresses(const DataAddressMoveList& moves) override;
+
 protected:
     // Responds to the event type specified in the attribute modifier.
     void ProcessEvent(Event& event) override;
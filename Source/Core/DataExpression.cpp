@@ -59,6 +59,9 @@ class DataParser;
 	In addition, each instruction has an optional payload:
 		D  Instruction data (payload).
 
+	After parsing, the program is optimized by evaluating operations on literals, and by passing single-instruction
+	operands through the registers instead of the stack.
+
 	Notation used in the instruction list below:
 		S+  Push to stack S.
 		S-  Pop stack S (returns the popped value).
@@ -67,6 +70,7 @@ enum class Instruction {
 	                        // Assignment (register/stack) = Read (register R/L/C, instruction data D, or stack)
 	Push         = 'P',     //      S+ = R
 	Pop          = 'o',     // <R/L/C> = S-  (D determines R/L/C)
+	Copy         = 'c',     //       L = R
 	Literal      = 'D',     //       R = D
 	Variable     = 'V',     //       R = DataModel.GetVariable(D)  (D is an index into the variable address list)
 	Add          = '+',     //       R = L + R
@@ -105,6 +109,8 @@ namespace Parse {
 	static void Expression(DataParser& parser);
 }
 
+static void OptimizeProgram(Program& program);
+
 
 class DataParser {
 public:
@@ -187,6 +193,9 @@ public:
 			Error(CreateString(120, "Internal parser error, inconsistent stack operations. Stack size is %d at parse end.", program_stack_size));
 		}
 
+		if (!parse_error)
+			OptimizeProgram(program);
+
 		return !parse_error;
 	}
 
@@ -752,8 +761,9 @@ namespace Parse {
 
 class DataInterpreter {
 public:
-	DataInterpreter(const Program& program, const AddressList& addresses, DataExpressionInterface expression_interface)
-		: program(program), addresses(addresses), expression_interface(expression_interface) {}
+	DataInterpreter(const Program& program, const AddressList& addresses, DataExpressionInterface expression_interface,
+		const AccessorList* accessors = nullptr, TransformCacheList* transform_caches = nullptr)
+		: program(program), addresses(addresses), accessors(accessors), transform_caches(transform_caches), expression_interface(expression_interface) {}
 
 	bool Error(String message) const
 	{
@@ -806,11 +816,15 @@ public:
 
 private:
 	Variant R, L, C;
-	Stack<Variant> stack;
+	Vector<Variant> stack;
 	Vector<Variant> arguments;
 
 	const Program& program;
 	const AddressList& addresses;
+	const AccessorList* accessors;
+	TransformCacheList* transform_caches;
+	// Programs never branch, thus transform functions are always called in the same order and can be identified by their call order.
+	size_t transform_index = 0;
 	DataExpressionInterface expression_interface;
 
 	bool Execute(const Instruction instruction, const Variant& data)
@@ -823,7 +837,7 @@ private:
 		{
 		case Instruction::Push:
 		{
-			stack.push(std::move(R));
+			stack.push_back(std::move(R));
 			R.Clear();
 		}
 		break;
@@ -834,14 +848,19 @@ private:
 
 			Register reg = Register(data.Get<int>(-1));
 			switch (reg) {
-			case Register::R:  R = stack.top(); stack.pop(); break;
-			case Register::L:  L = stack.top(); stack.pop(); break;
-			case Register::C:  C = stack.top(); stack.pop(); break;
+			case Register::R:  R = std::move(stack.back()); stack.pop_back(); break;
+			case Register::L:  L = std::move(stack.back()); stack.pop_back(); break;
+			case Register::C:  C = std::move(stack.back()); stack.pop_back(); break;
 			default:
 				return Error(CreateString(50, "Invalid register %d.", int(reg)));
 			}
 		}
 		break;
+		case Instruction::Copy:
+		{
+			L = R;
+		}
+		break;
 		case Instruction::Literal:
 		{
 			R = data;
@@ -850,10 +869,13 @@ private:
 		case Instruction::Variable:
 		{
 			size_t variable_index = size_t(data.Get<int>(-1));
-			if (variable_index < addresses.size())
-				R = expression_interface.GetValue(addresses[variable_index]);
-			else
+			if (variable_index >= addresses.size())
 				return Error("Variable address not found.");
+
+			if (accessors && variable_index < accessors->size())
+				R = expression_interface.GetValue(addresses[variable_index], (*accessors)[variable_index]);
+			else
+				R = expression_interface.GetValue(addresses[variable_index]);
 		}
 		break;
 		case Instruction::Add:
@@ -910,16 +932,51 @@ private:
 			arguments.resize(num_arguments);
 			for (int i = num_arguments - 1; i >= 0; i--)
 			{
-				arguments[i] = std::move(stack.top());
-				stack.pop();
+				arguments[i] = std::move(stack.back());
+				stack.pop_back();
 			}
 		}
 		break;
 		case Instruction::TransformFnc:
 		{
-			const String function_name = data.Get<String>();
-			
-			if (!expression_interface.CallTransform(function_name, R, arguments))
+			const String& function_name = data.GetReference<String>();
+
+			DataTransformCache* cache = nullptr;
+			if (transform_caches)
+			{
+				if (transform_index >= transform_caches->size())
+					transform_caches->resize(transform_index + 1);
+				cache = &(*transform_caches)[transform_index];
+			}
+			transform_index += 1;
+
+			if (cache && cache->valid && cache->input == R && cache->arguments == arguments)
+			{
+				R = cache->result;
+				arguments.clear();
+				break;
+			}
+
+			Variant input;
+			if (cache && cache->is_pure)
+				input = R;
+
+			bool is_pure = false;
+			const bool success = expression_interface.CallTransform(function_name, R, arguments, &is_pure);
+
+			if (cache)
+			{
+				cache->valid = (success && is_pure);
+				cache->is_pure = is_pure;
+				if (cache->valid)
+				{
+					cache->input = std::move(input);
+					cache->arguments = arguments;
+					cache->result = R;
+				}
+			}
+
+			if (!success)
 			{
 				String arguments_str;
 				for (size_t i = 0; i < arguments.size(); i++)
@@ -973,6 +1030,83 @@ private:
 };
 
 
+static bool IsBinaryOperation(Instruction instruction)
+{
+	switch (instruction)
+	{
+	case Instruction::Add:
+	case Instruction::Subtract:
+	case Instruction::Multiply:
+	case Instruction::Divide:
+	case Instruction::And:
+	case Instruction::Or:
+	case Instruction::Less:
+	case Instruction::LessEq:
+	case Instruction::Greater:
+	case Instruction::GreaterEq:
+	case Instruction::Equal:
+	case Instruction::NotEqual:
+		return true;
+	default:
+		break;
+	}
+	return false;
+}
+
+static void OptimizeProgram(Program& program)
+{
+	auto IsPopL = [](const InstructionData& data) {
+		return data.instruction == Instruction::Pop && data.data.Get<int>(-1) == int(Register::L);
+	};
+
+	// Evaluate operations on literals, repeated until no more operations can be evaluated so that nested operations are folded too.
+	//   'Literal a, Push, Literal b, Pop L, <op>'  ->  'Literal (a <op> b)'
+	//   'Literal a, Not'                           ->  'Literal (!a)'
+	bool folded = true;
+	while (folded)
+	{
+		folded = false;
+		for (size_t i = 0; i < program.size(); i++)
+		{
+			if (program[i].instruction != Instruction::Literal)
+				continue;
+
+			size_t length = 0;
+			if (i + 1 < program.size() && program[i + 1].instruction == Instruction::Not)
+				length = 2;
+			else if (i + 4 < program.size() && program[i + 1].instruction == Instruction::Push && program[i + 2].instruction == Instruction::Literal &&
+				IsPopL(program[i + 3]) && IsBinaryOperation(program[i + 4].instruction))
+				length = 5;
+
+			if (length == 0)
+				continue;
+
+			const Program operation(program.begin() + i, program.begin() + i + length);
+			const AddressList no_addresses;
+			DataInterpreter interpreter(operation, no_addresses, DataExpressionInterface());
+			if (!interpreter.Run())
+				continue;
+
+			program[i] = InstructionData{ Instruction::Literal, interpreter.Result() };
+			program.erase(program.begin() + i + 1, program.begin() + i + length);
+			folded = true;
+		}
+	}
+
+	// Pass operands consisting of a single instruction through the registers instead of the stack.
+	//   'Push, <Literal|Variable>, Pop L'  ->  'Copy, <Literal|Variable>'
+	for (size_t i = 0; i + 2 < program.size(); i++)
+	{
+		const Instruction operand = program[i + 1].instruction;
+		if (program[i].instruction == Instruction::Push && (operand == Instruction::Literal || operand == Instruction::Variable) && IsPopL(program[i + 2]))
+		{
+			program[i] = InstructionData{ Instruction::Copy, Variant() };
+			program.erase(program.begin() + i + 2);
+		}
+	}
+}
+
+
 DataExpression::DataExpression(String expression) : expression(expression)
 {}
 
@@ -987,13 +1121,23 @@ bool DataExpression::Parse(const DataExpressionInterface& expression_interface,
 
 	program = parser.ReleaseProgram();
 	addresses = parser.ReleaseAddresses();
+	accessors.clear();
+	transform_caches.clear();
 
 	return true;
 }
 
 bool DataExpression::Run(const DataExpressionInterface& expression_interface, Variant& out_value)
 {
-	DataInterpreter interpreter(program, addresses, expression_interface);
+	if (accessors.size() != addresses.size())
+	{
+		accessors.clear();
+		accessors.reserve(addresses.size());
+		for (const DataAddress& address : addresses)
+			accessors.push_back(expression_interface.GetAccessor(address));
+	}
+
+	DataInterpreter interpreter(program, addresses, expression_interface, &accessors, &transform_caches);
 	
 	if (!interpreter.Run())
 		return false;
@@ -1002,16 +1146,21 @@ bool DataExpression::Run(const DataExpressionInterface& expression_interface, Va
 	return true;
 }
 
-StringList DataExpression::GetVariableNameList() const
+const AddressList& DataExpression::GetVariableAddressList() const
 {
-	StringList list;
-	list.reserve(addresses.size());
-	for (const DataAddress& address : addresses)
-	{
-		if (!address.empty())
-			list.push_back(address[0].name);
-	}
-	return list;
+	return addresses;
+}
+
+bool DataExpression::MoveAddresses(const DataAddressMoveList& moves)
+{
+	bool result = false;
+	for (DataAddress& address : addresses)
+		result |= MoveDataAddress(address, moves);
+
+	if (result)
+		accessors.clear();
+
+	return result;
 }
 
 DataExpressionInterface::DataExpressionInterface(DataModel* data_model, Element* element, Event* event) : data_model(data_model), element(element), event(event)
@@ -1024,6 +1173,24 @@ DataAddress DataExpressionInterface::ParseAddress(const String& address_str) con
 
 	return data_model ? data_model->ResolveAddress(address_str, element) : DataAddress();
 }
+DataVariableAccessor DataExpressionInterface::GetAccessor(const DataAddress& address) const
+{
+	DataVariableAccessor accessor;
+	if (data_model && !(address.size() == 2 && address.front().name == "ev"))
+		accessor.variable = data_model->GetStableVariable(address, accessor.num_entries);
+	return accessor;
+}
+
+Variant DataExpressionInterface::GetValue(const DataAddress& address, const DataVariableAccessor& accessor) const
+{
+	if (!accessor.variable || !data_model)
+		return GetValue(address);
+
+	Variant result;
+	data_model->GetVariableInto(address, accessor.variable, accessor.num_entries, result);
+	return result;
+}
+
 Variant DataExpressionInterface::GetValue(const DataAddress& address) const
 {
 	Variant result;
@@ -1050,14 +1217,14 @@ bool DataExpressionInterface::SetValue(const DataAddress& address, const Variant
 			result = variable.Set(value);
 
 		if (result)
-			data_model->DirtyVariable(address.front().name);
+			data_model->DirtyAssignedAddress(address);
 	}
 	return result;
 }
 
-bool DataExpressionInterface::CallTransform(const String& name, Variant& inout_variant, const VariantList& arguments)
+bool DataExpressionInterface::CallTransform(const String& name, Variant& inout_variant, const VariantList& arguments, bool* out_is_pure)
 {
-	return data_model ? data_model->CallTransform(name, inout_variant, arguments) : false;
+	return data_model ? data_model->CallTransform(name, inout_variant, arguments, out_is_pure) : false;
 }
 
 bool DataExpressionInterface::EventCallback(const String& name, const VariantList& arguments)
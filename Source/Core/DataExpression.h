@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/DataTypes.h"
+#include "../../Include/RmlUi/Core/DataVariable.h"
 
 namespace Rml {
 
@@ -40,6 +41,25 @@ class DataModel;
 struct InstructionData;
 using Program = Vector<InstructionData>;
 using AddressList = Vector<DataAddress>;
+struct DataAddressMove;
+using DataAddressMoveList = Vector<DataAddressMove>;
+
+// Variable resolved from the start of an address which does not change between runs, see DataModel::GetStableVariable().
+struct DataVariableAccessor {
+	DataVariable variable;
+	size_t num_entries = 0;
+};
+using AccessorList = Vector<DataVariableAccessor>;
+
+// Last call to a transform function, its result is reused while the input and arguments are unchanged if the function is pure.
+struct DataTransformCache {
+	bool valid = false;
+	bool is_pure = true;
+	Variant input;
+	VariantList arguments;
+	Variant result;
+};
+using TransformCacheList = Vector<DataTransformCache>;
 
 class DataExpressionInterface {
 public:
@@ -48,8 +68,10 @@ public:
 
     DataAddress ParseAddress(const String& address_str) const;
     Variant GetValue(const DataAddress& address) const;
+    DataVariableAccessor GetAccessor(const DataAddress& address) const;
+    Variant GetValue(const DataAddress& address, const DataVariableAccessor& accessor) const;
     bool SetValue(const DataAddress& address, const Variant& value) const;
-    bool CallTransform(const String& name, Variant& inout_result, const VariantList& arguments);
+    bool CallTransform(const String& name, Variant& inout_result, const VariantList& arguments, bool* out_is_pure = nullptr);
     bool EventCallback(const String& name, const VariantList& arguments);
 
 private:
@@ -69,13 +91,20 @@ public:
     bool Run(const DataExpressionInterface& expression_interface, Variant& out_value);
 
     // Available after Parse()
-    StringList GetVariableNameList() const;
+    const AddressList& GetVariableAddressList() const;
+
+    // Move the variable addresses of the parsed expression, returns true if any address changed.
+    bool MoveAddresses(const DataAddressMoveList& moves);
 
 private:
     String expression;
     
     Program program;
     AddressList addresses;
+
+    // Resolved during the first run.
+    AccessorList accessors;
+    TransformCacheList transform_caches;
 };
 
 } // namespace Rml
@@ -27,10 +27,13 @@
  */
 
 #include "DataModel.h"
+#include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/DataTypeRegister.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "DataController.h"
 #include "DataView.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -75,6 +78,27 @@ static DataAddress ParseAddress(const String& address_str)
 	return address;
 }
 
+bool MoveDataAddress(DataAddress& address, const DataAddressMoveList& moves)
+{
+	for (const DataAddressMove& move : moves)
+	{
+		if (move.from.size() > address.size())
+			continue;
+
+		const bool starts_with = std::equal(move.from.begin(), move.from.end(), address.begin(), [](const DataAddressEntry& a, const DataAddressEntry& b) {
+			return a.index == b.index && a.name == b.name;
+		});
+
+		if (starts_with)
+		{
+			address.erase(address.begin(), address.begin() + move.from.size());
+			address.insert(address.begin(), move.to.begin(), move.to.end());
+			return true;
+		}
+	}
+	return false;
+}
+
 // Returns an error string on error, or nullptr on success.
 static const char* LegalVariableName(const String& name)
 {
@@ -139,6 +163,11 @@ void DataModel::AddController(DataControllerPtr controller) {
 	controllers->Add(std::move(controller));
 }
 
+void DataModel::DirtyView(DataView* view)
+{
+	views->DirtyView(view);
+}
+
 bool DataModel::BindVariable(const String& name, DataVariable variable)
 {
 	const char* name_error_str = LegalVariableName(name);
@@ -232,6 +261,38 @@ bool DataModel::EraseAliases(Element* element)
 	return aliases.erase(element) == 1;
 }
 
+void DataModel::MoveAddresses(const ElementAddressMoves& element_moves)
+{
+	if (element_moves.empty())
+		return;
+
+	for (const auto& element_move : element_moves)
+	{
+		const DataAddressMoveList& moves = element_move.second;
+
+		ElementList search_list = { element_move.first };
+		while (!search_list.empty())
+		{
+			Element* element = search_list.back();
+			search_list.pop_back();
+
+			auto it = aliases.find(element);
+			if (it != aliases.end())
+			{
+				for (auto& alias : it->second)
+					MoveDataAddress(alias.second, moves);
+			}
+
+			controllers->MoveAddresses(element, moves);
+
+			for (int i = 0; i < element->GetNumChildren(); i++)
+				search_list.push_back(element->GetChild(i));
+		}
+	}
+
+	views->MoveAddresses(*this, element_moves);
+}
+
 DataAddress DataModel::ResolveAddress(const String& address_str, Element* element) const
 {
 	DataAddress address = ParseAddress(address_str);
@@ -301,6 +362,7 @@ DataVariable DataModel::GetVariable(const DataAddress& address) const
 
 	if (address[0].name == "literal")
 	{
+		// Any further entries only identify the origin of the literal, such as the 'data-for' loop of an index.
 		if (address.size() > 2 && address[1].name == "int")
 			return MakeLiteralIntVariable(address[2].index);
 	}
@@ -328,6 +390,48 @@ bool DataModel::GetVariableInto(const DataAddress& address, Variant& out_value)
 	return result;
 }
 
+DataVariable DataModel::GetStableVariable(const DataAddress& address, size_t& out_num_entries) const
+{
+	out_num_entries = 0;
+	if (address.empty())
+		return DataVariable();
+
+	auto it = variables.find(address.front().name);
+	if (it == variables.end())
+	{
+		// Literals never change.
+		DataVariable variable = GetVariable(address);
+		if (variable)
+			out_num_entries = address.size();
+		return variable;
+	}
+
+	// Struct members are located at fixed offsets from their parent, while array entries may be relocated.
+	DataVariable variable = it->second;
+	size_t num_entries = 1;
+	for (; num_entries < address.size() && variable.Type() == DataVariableType::Struct; num_entries++)
+	{
+		variable = variable.Child(address[num_entries]);
+		if (!variable)
+			return DataVariable();
+	}
+
+	out_num_entries = num_entries;
+	return variable;
+}
+
+bool DataModel::GetVariableInto(const DataAddress& address, DataVariable stable_variable, size_t num_stable_entries, Variant& out_value) const
+{
+	DataVariable variable = stable_variable;
+	for (size_t i = num_stable_entries; i < address.size() && variable; i++)
+		variable = variable.Child(address[i]);
+
+	bool result = (variable && variable.Get(out_value));
+	if (!result)
+		Log::Message(Log::LT_WARNING, "Could not get value from data variable '%s'.", DataAddressToString(address).c_str());
+	return result;
+}
+
 void DataModel::DirtyVariable(const String& variable_name)
 {
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
@@ -335,16 +439,47 @@ void DataModel::DirtyVariable(const String& variable_name)
 	dirty_variables.emplace(variable_name);
 }
 
+void DataModel::DirtyAddress(const DataAddress& address)
+{
+	RMLUI_ASSERTMSG(!address.empty() && variables.count(address.front().name) == 1, "In DirtyAddress: Variable name not found among added variables.");
+	if (address.empty())
+		return;
+
+	if (address.size() == 1)
+	{
+		DirtyVariable(address.front().name);
+		return;
+	}
+
+	if (dirty_variables.count(address.front().name) == 0)
+		dirty_addresses.push_back(address);
+}
+
+void DataModel::DirtyAssignedAddress(const DataAddress& address)
+{
+	if (address.empty())
+		return;
+
+	auto it_index = std::find_if(address.begin(), address.end(), [](const DataAddressEntry& entry) { return entry.index >= 0; });
+	if (it_index == address.end())
+		DirtyVariable(address.front().name);
+	else
+		DirtyAddress(DataAddress(address.begin(), it_index + 1));
+}
+
 bool DataModel::IsVariableDirty(const String& variable_name) const
 {
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
-	return dirty_variables.count(variable_name) == 1;
+	if (dirty_variables.count(variable_name) == 1)
+		return true;
+
+	return std::any_of(dirty_addresses.begin(), dirty_addresses.end(), [&](const DataAddress& address) { return address.front().name == variable_name; });
 }
 
-bool DataModel::CallTransform(const String& name, Variant& inout_result, const VariantList& arguments) const
+bool DataModel::CallTransform(const String& name, Variant& inout_result, const VariantList& arguments, bool* out_is_pure) const
 {
 	if (transform_register)
-		return transform_register->Call(name, inout_result, arguments);
+		return transform_register->Call(name, inout_result, arguments, out_is_pure);
 	return false;
 }
 
@@ -366,14 +501,27 @@ void DataModel::OnElementRemove(Element* element)
 	attached_elements.erase(element);
 }
 
-bool DataModel::Update(bool clear_dirty_variables)
+bool DataModel::Update(bool clear_dirty_variables, double deadline)
 {
-	const bool result = views->Update(*this, dirty_variables);
+	SystemInterface* system_interface = GetSystemInterface();
+	const double time_begin = (system_interface ? system_interface->GetElapsedTime() : 0.0);
+
+	statistics = DataModelStatistics();
+	const bool result = views->Update(*this, dirty_variables, dirty_addresses, deadline, statistics);
+	statistics.update_time = (system_interface ? system_interface->GetElapsedTime() - time_begin : 0.0);
 
 	if (clear_dirty_variables)
+	{
 		dirty_variables.clear();
+		dirty_addresses.clear();
+	}
 	
 	return result;
 }
 
+const DataModelStatistics& DataModel::GetStatistics() const
+{
+	return statistics;
+}
+
 } // namespace Rml
@@ -41,6 +41,17 @@ class DataViews;
 class DataControllers;
 class Element;
 
+// Describes data bindings moving from one address to another, such as when a 'data-for' entry changes its index.
+struct DataAddressMove {
+	DataAddress from;
+	DataAddress to;
+};
+using DataAddressMoveList = Vector<DataAddressMove>;
+using ElementAddressMoves = UnorderedMap<Element*, DataAddressMoveList>;
+
+// Replace the start of the address by the first move it starts with. Returns true if the address was changed.
+bool MoveDataAddress(DataAddress& address, const DataAddressMoveList& moves);
+
 
 class DataModel : NonCopyMoveable {
 public:
@@ -48,6 +59,8 @@ public:
 	~DataModel();
 
 	void AddView(DataViewPtr view);
+	// Request an update of the given view during the next update, regardless of its variables.
+	void DirtyView(DataView* view);
 	void AddController(DataControllerPtr controller);
 
 	bool BindVariable(const String& name, DataVariable variable);
@@ -58,16 +71,30 @@ public:
 	bool InsertAlias(Element* element, const String& alias_name, DataAddress replace_with_address);
 	bool EraseAliases(Element* element);
 
+	// Move the aliases, views and controllers in the subtree of each element to their new addresses.
+	void MoveAddresses(const ElementAddressMoves& element_moves);
+
 	DataAddress ResolveAddress(const String& address_str, Element* element) const;
 	const DataEventFunc* GetEventCallback(const String& name);
 
 	DataVariable GetVariable(const DataAddress& address) const;
 	bool GetVariableInto(const DataAddress& address, Variant& out_value) const;
 
+	// Returns the variable of the longest start of the address which always refers to the same variable, that is, the
+	// top-level variable and any struct members below it. The number of address entries resolved is written to the output.
+	DataVariable GetStableVariable(const DataAddress& address, size_t& out_num_entries) const;
+	// Same as GetVariableInto(), but continues from a variable returned by GetStableVariable().
+	bool GetVariableInto(const DataAddress& address, DataVariable stable_variable, size_t num_stable_entries, Variant& out_value) const;
+
 	void DirtyVariable(const String& variable_name);
+	// Dirty part of a variable, only views reading from the address or any of its parents or children are updated.
+	void DirtyAddress(const DataAddress& address);
+	// Dirty an address after assigning to it from a controller or expression. Members of the same array element may be
+	// derived from the assigned value, so the whole element is dirtied, or the whole variable when not inside an array.
+	void DirtyAssignedAddress(const DataAddress& address);
 	bool IsVariableDirty(const String& variable_name) const;
 
-	bool CallTransform(const String& name, Variant& inout_result, const VariantList& arguments) const;
+	bool CallTransform(const String& name, Variant& inout_result, const VariantList& arguments, bool* out_is_pure = nullptr) const;
 
 	// Elements declaring 'data-model' need to be attached.
 	void AttachModelRootElement(Element* element);
@@ -75,7 +102,11 @@ public:
 
 	void OnElementRemove(Element* element);
 
-	bool Update(bool clear_dirty_variables);
+	// Update the views of the dirty variables. When the elapsed time reaches the deadline, any remaining non-structural views
+	// are deferred to the next update. A deadline of zero updates all views.
+	bool Update(bool clear_dirty_variables, double deadline = 0);
+
+	const DataModelStatistics& GetStatistics() const;
 
 private:
 	UniquePtr<DataViews> views;
@@ -83,6 +114,7 @@ private:
 
 	UnorderedMap<String, DataVariable> variables;
 	DirtyVariables dirty_variables;
+	Vector<DataAddress> dirty_addresses;
 
 	UnorderedMap<String, UniquePtr<FuncDefinition>> function_variable_definitions;
 	UnorderedMap<String, DataEventFunc> event_callbacks;
@@ -93,6 +125,8 @@ private:
 	const TransformFuncRegister* transform_register;
 
 	SmallUnorderedSet<Element*> attached_elements;
+
+	DataModelStatistics statistics;
 };
 
 
@@ -43,6 +43,21 @@ void DataModelHandle::DirtyVariable(const String& variable_name) {
 	model->DirtyVariable(variable_name);
 }
 
+void DataModelHandle::DirtyAddress(const String& address_str) {
+	DataAddress address = model->ResolveAddress(address_str, nullptr);
+	if (!address.empty())
+		model->DirtyAddress(address);
+}
+
+void DataModelHandle::DirtyArrayRange(const String& variable_name, int index_begin, int index_end) {
+	for (int i = index_begin; i < index_end; i++)
+		model->DirtyAddress(DataAddress{ DataAddressEntry(variable_name), DataAddressEntry(i) });
+}
+
+const DataModelStatistics& DataModelHandle::GetStatistics() const {
+	return model->GetStatistics();
+}
+
 
 DataModelConstructor::DataModelConstructor() : model(nullptr), type_register(nullptr) {}
 
@@ -0,0 +1,206 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "DataTemplate.h"
+#include "XMLParseTools.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementUtilities.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
+#include <algorithm>
+
+namespace Rml {
+
+// Records the parsed nodes instead of instancing elements, mirroring the behavior of the XMLParser with the default node handler.
+class DataTemplateParser : public BaseXMLParser {
+public:
+	DataTemplateParser(DataTemplate::Node& root)
+	{
+		RegisterCDATATag("script");
+
+		for (const String& name : Factory::GetStructuralDataViewAttributeNames())
+			RegisterInnerXMLAttribute(name);
+
+		stack.push_back(&root);
+	}
+
+	void HandleElementStart(const String& in_name, const XMLAttributes& attributes) override
+	{
+		const String name = StringUtilities::ToLower(in_name);
+
+		// The outermost tag only wraps the contents, the remaining tags must all be handled by the default node handler.
+		if (!root_opened)
+		{
+			root_opened = true;
+			return;
+		}
+
+		if (XMLParser::GetNodeHandler(name))
+			valid = false;
+
+		DataTemplate::Node& parent = *stack.back();
+		parent.children.emplace_back();
+
+		DataTemplate::Node& node = parent.children.back();
+		node.tag = name;
+		node.attributes = attributes;
+
+		stack.push_back(&node);
+	}
+
+	void HandleElementEnd(const String& /*name*/) override
+	{
+		if (stack.size() > 1)
+			stack.pop_back();
+	}
+
+	void HandleData(const String& data, XMLDataType type) override
+	{
+		// Text nodes with only white-space are never constructed.
+		if (type == XMLDataType::Text && std::all_of(data.begin(), data.end(), &StringUtilities::IsWhitespace))
+			return;
+
+		DataTemplate::Node& parent = *stack.back();
+		parent.children.emplace_back();
+
+		DataTemplate::Node& node = parent.children.back();
+		node.data = data;
+		node.data_type = type;
+	}
+
+	bool IsValid() const { return valid; }
+
+private:
+	Vector<DataTemplate::Node*> stack;
+	bool root_opened = false;
+	bool valid = true;
+};
+
+
+UniquePtr<DataTemplate> DataTemplate::Compile(const String& in_rml, const String& base_tag)
+{
+	RMLUI_ZoneScoped;
+
+	UniquePtr<DataTemplate> result(new DataTemplate);
+
+	String rml = in_rml;
+	if (SystemInterface* system_interface = GetSystemInterface())
+		system_interface->TranslateString(rml, in_rml);
+
+	// See if we need to parse it as RML, tags inside data expressions are not considered.
+	bool parse_as_rml = false;
+	bool inside_brackets = false;
+	char previous = 0;
+	for (const char c : rml)
+	{
+		// Leave any errors to be reported on use.
+		if (XMLParseTools::ParseDataBrackets(inside_brackets, c, previous))
+			return nullptr;
+
+		if (!inside_brackets && c == '<')
+			parse_as_rml = true;
+
+		previous = c;
+	}
+
+	// Contents without any tags are instanced directly as a single text element, which translates the original string itself.
+	if (!parse_as_rml)
+	{
+		if (!std::all_of(rml.begin(), rml.end(), &StringUtilities::IsWhitespace))
+		{
+			result->nodes.emplace_back();
+			result->nodes.back().data = in_rml;
+		}
+		return result;
+	}
+
+	const String open_tag = "<" + base_tag + ">";
+	const String close_tag = "</" + base_tag + ">";
+
+	auto stream = MakeUnique<StreamMemory>(rml.size() + 32);
+	stream->Write(open_tag.c_str(), open_tag.size());
+	stream->Write(rml);
+	stream->Write(close_tag.c_str(), close_tag.size());
+	stream->Seek(0, SEEK_SET);
+
+	Node root;
+	DataTemplateParser parser(root);
+	parser.Parse(stream.get());
+
+	if (!parser.IsValid())
+		return nullptr;
+
+	result->nodes = std::move(root.children);
+
+	return result;
+}
+
+void DataTemplate::Instance(Element* parent) const
+{
+	RMLUI_ZoneScoped;
+	RMLUI_ASSERT(parent);
+
+	InstanceNodes(parent, nodes);
+}
+
+void DataTemplate::InstanceNodes(Element* parent, const Vector<Node>& nodes)
+{
+	for (const Node& node : nodes)
+	{
+		if (node.tag.empty())
+		{
+			// Structural data views use the raw inner RML contents of the node, see XMLNodeHandlerDefault::ElementData().
+			if (node.data_type == XMLDataType::InnerXML && ElementUtilities::ApplyStructuralDataViews(parent, node.data))
+				continue;
+
+			Factory::InstanceElementText(parent, node.data);
+			continue;
+		}
+
+		ElementPtr element = Factory::InstanceElement(parent, node.tag, node.tag, node.attributes);
+		if (!element)
+		{
+			Log::Message(Log::LT_ERROR, "Failed to create element for tag %s, instancer returned nullptr.", node.tag.c_str());
+
+			// Like the XML parser, any children are then added to the current parent.
+			InstanceNodes(parent, node.children);
+			continue;
+		}
+
+		Element* child = parent->AppendChild(std::move(element));
+		InstanceNodes(child, node.children);
+	}
+}
+
+} // namespace Rml
@@ -0,0 +1,77 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_DATATEMPLATE_H
+#define RMLUI_CORE_DATATEMPLATE_H
+
+#include "../../Include/RmlUi/Core/Header.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/BaseXMLParser.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+	Data template.
+
+	A tree of element tags, attributes and text parsed once from the inner RML of a structural data view. The template
+	can then be instanced any number of times without running the XML parser, such as for every row of a 'data-for' view.
+ */
+
+class DataTemplate : NonCopyMoveable {
+public:
+	// Parse the given RML contents into a template.
+	// @param[in] rml The inner RML contents, with the same format as passed to Element::SetInnerRML().
+	// @param[in] base_tag The tag used to wrap the contents during parsing, normally the documents base tag.
+	// @return The compiled template, or nullptr if the contents require custom node handlers and must be parsed on every use.
+	static UniquePtr<DataTemplate> Compile(const String& rml, const String& base_tag);
+
+	// Instance the template as children of the given element, equivalent to calling SetInnerRML() with the original contents.
+	void Instance(Element* parent) const;
+
+	struct Node {
+		// Element tag, or empty for data nodes.
+		String tag;
+		XMLAttributes attributes;
+		// Text contents of data nodes, or the unparsed inner RML of structural data views.
+		String data;
+		XMLDataType data_type = XMLDataType::Text;
+		Vector<Node> children;
+	};
+
+private:
+	DataTemplate() = default;
+
+	static void InstanceNodes(Element* parent, const Vector<Node>& nodes);
+
+	Vector<Node> nodes;
+};
+
+} // namespace Rml
+#endif
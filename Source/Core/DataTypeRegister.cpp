@@ -32,7 +32,7 @@ namespace Rml {
 
 DataTypeRegister::DataTypeRegister()
 {
-    // Add default transform functions.
+    // Add default transform functions, all of them pure.
 
 	transform_register.Register("to_lower", [](Variant& variant, const VariantList& /*arguments*/) -> bool {
 		String value;
@@ -40,7 +40,7 @@ DataTypeRegister::DataTypeRegister()
 			return false;
 		variant = StringUtilities::ToLower(value);
 		return true;
-	});
+	}, true);
 
 	transform_register.Register("to_upper", [](Variant& variant, const VariantList& /*arguments*/) -> bool {
 		String value;
@@ -48,7 +48,7 @@ DataTypeRegister::DataTypeRegister()
 			return false;
 		variant = StringUtilities::ToUpper(value);
 		return true;
-	});
+	}, true);
 
 	transform_register.Register("format", [](Variant& variant, const VariantList& arguments) -> bool {
         // Arguments in:
@@ -83,7 +83,7 @@ DataTypeRegister::DataTypeRegister()
 
         variant = result;
 		return true;
-	});
+	}, true);
 
 	transform_register.Register("round", [](Variant& variant, const VariantList& /*arguments*/) -> bool {
 		double value = 0;
@@ -91,16 +91,16 @@ DataTypeRegister::DataTypeRegister()
 			return false;
         variant = Math::RoundFloat(value);
 		return true;
-	});
+	}, true);
 }
 
 DataTypeRegister::~DataTypeRegister()
 {}
 
-void TransformFuncRegister::Register(const String& name, DataTransformFunc transform_func)
+void TransformFuncRegister::Register(const String& name, DataTransformFunc transform_func, bool is_pure)
 {
     RMLUI_ASSERT(transform_func);
-    bool inserted = transform_functions.emplace(name, std::move(transform_func)).second;
+    bool inserted = transform_functions.emplace(name, TransformFunc{ std::move(transform_func), is_pure }).second;
     if (!inserted)
     {
         Log::Message(Log::LT_ERROR, "Transform function '%s' already exists.", name.c_str());
@@ -108,15 +108,18 @@ void TransformFuncRegister::Register(const String& name, DataTransformFunc trans
     }
 }
 
-bool TransformFuncRegister::Call(const String& name, Variant& inout_result, const VariantList& arguments) const
+bool TransformFuncRegister::Call(const String& name, Variant& inout_result, const VariantList& arguments, bool* out_is_pure) const
 {
     auto it = transform_functions.find(name);
     if (it == transform_functions.end())
         return false;
 
-    const DataTransformFunc& transform_func = it->second;
+    const DataTransformFunc& transform_func = it->second.function;
     RMLUI_ASSERT(transform_func);
 
+    if (out_is_pure)
+        *out_is_pure = it->second.is_pure;
+
     return transform_func(inout_result, arguments);
 }
 
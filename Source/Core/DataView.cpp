@@ -27,7 +27,9 @@
  */
 
 #include "DataView.h"
+#include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
 #include <algorithm>
 
 namespace Rml {
@@ -70,6 +72,10 @@ void DataViews::Add(DataViewPtr view) {
 	views_to_add.push_back(std::move(view));
 }
 
+void DataViews::DirtyView(DataView* view) {
+	requested_views.push_back(view);
+}
+
 void DataViews::OnElementRemove(Element* element) 
 {
 	for (auto it = views.begin(); it != views.end();)
@@ -77,6 +83,8 @@ void DataViews::OnElementRemove(Element* element)
 		auto& view = *it;
 		if (view && view->GetElement() == element)
 		{
+			requested_views.erase(std::remove(requested_views.begin(), requested_views.end(), view.get()), requested_views.end());
+			deferred_views.erase(std::remove(deferred_views.begin(), deferred_views.end(), view.get()), deferred_views.end());
 			views_to_remove.push_back(std::move(view));
 			it = views.erase(it);
 		}
@@ -85,35 +93,206 @@ void DataViews::OnElementRemove(Element* element)
 	}
 }
 
-bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
+// Returns true if one of the addresses is a parent of, or equal to, the other.
+static bool IsAddressOverlapping(const DataAddress& a, const DataAddress& b)
+{
+	const size_t size = std::min(a.size(), b.size());
+	for (size_t i = 0; i < size; i++)
+	{
+		if (a[i].index != b[i].index || a[i].name != b[i].name)
+			return false;
+	}
+	return true;
+}
+
+template<typename Map, typename Key>
+static void EraseView(Map& map, const Key& key, const DataView* view)
+{
+	auto pair = map.equal_range(key);
+	for (auto it = pair.first; it != pair.second;)
+	{
+		if (it->second.view == view)
+			it = map.erase(it);
+		else
+			++it;
+	}
+}
+
+void DataViews::RegisterAddresses(DataView* view)
+{
+	for (DataAddress& address : view->GetVariableAddressList())
+	{
+		if (address.empty())
+			continue;
+
+		String variable_name = address.front().name;
+		if (address.size() >= 2 && address[1].index >= 0)
+		{
+			const int index = address[1].index;
+			index_view_map[variable_name].emplace(index, AddressView{ std::move(address), view });
+		}
+		else
+			name_view_map.emplace(std::move(variable_name), AddressView{ std::move(address), view });
+	}
+}
+
+void DataViews::UnregisterAddresses(DataView* view)
+{
+	for (const DataAddress& address : view->GetVariableAddressList())
+	{
+		if (address.empty())
+			continue;
+
+		if (address.size() >= 2 && address[1].index >= 0)
+		{
+			auto it_index = index_view_map.find(address.front().name);
+			if (it_index != index_view_map.end())
+				EraseView(it_index->second, address[1].index, view);
+		}
+		else
+			EraseView(name_view_map, address.front().name, view);
+	}
+}
+
+void DataViews::MoveAddresses(DataModel& model, const ElementAddressMoves& element_moves)
+{
+	auto find_moves = [&](DataView* view) -> const DataAddressMoveList* {
+		for (Element* element = view->GetElement(); element; element = element->GetParentNode())
+		{
+			auto it = element_moves.find(element);
+			if (it != element_moves.end())
+				return &it->second;
+		}
+		return nullptr;
+	};
+
+	// Views not yet added are registered with their new addresses later.
+	for (DataViewPtr& view : views_to_add)
+	{
+		if (const DataAddressMoveList* moves = find_moves(view.get()))
+			view->MoveAddresses(*moves);
+	}
+
+	Vector<DataView*> changed_views;
+
+	for (DataViewPtr& view : views)
+	{
+		const DataAddressMoveList* moves = (view && view->IsValid() ? find_moves(view.get()) : nullptr);
+		if (!moves)
+			continue;
+
+		const Vector<DataAddress> previous_addresses = view->GetVariableAddressList();
+		UnregisterAddresses(view.get());
+		const bool changed = view->MoveAddresses(*moves);
+		RegisterAddresses(view.get());
+
+		// The moved entries keep their values, but literals such as the iterator index may change.
+		if (changed && std::any_of(previous_addresses.begin(), previous_addresses.end(), [](const DataAddress& address) { return !address.empty() && address.front().name == "literal"; }))
+			changed_views.push_back(view.get());
+	}
+
+	// Views may be removed during updates, thus update them only after iterating.
+	for (DataView* view : changed_views)
+	{
+		if (view->IsValid())
+			view->Update(model);
+	}
+}
+
+void DataViews::GatherDirtyViews(Vector<DataView*>& dirty_views, const DirtyVariables& dirty_variables, const Vector<DataAddress>& dirty_addresses) const
+{
+	// Dirty variables update all views reading any part of them.
+	for (const String& variable_name : dirty_variables)
+	{
+		auto pair = name_view_map.equal_range(variable_name);
+		for (auto it = pair.first; it != pair.second; ++it)
+			dirty_views.push_back(it->second.view);
+
+		auto it_index = index_view_map.find(variable_name);
+		if (it_index != index_view_map.end())
+		{
+			for (auto& index_view : it_index->second)
+				dirty_views.push_back(index_view.second.view);
+		}
+	}
+
+	// Dirty addresses only update the views reading the same part of a variable, or any of its parents or children.
+	for (const DataAddress& dirty_address : dirty_addresses)
+	{
+		RMLUI_ASSERT(dirty_address.size() >= 2);
+		const String& variable_name = dirty_address.front().name;
+		if (dirty_variables.count(variable_name))
+			continue;
+
+		auto pair = name_view_map.equal_range(variable_name);
+		for (auto it = pair.first; it != pair.second; ++it)
+		{
+			if (IsAddressOverlapping(it->second.address, dirty_address))
+				dirty_views.push_back(it->second.view);
+		}
+
+		const int index = dirty_address[1].index;
+		auto it_index = index_view_map.find(variable_name);
+		if (index >= 0 && it_index != index_view_map.end())
+		{
+			auto index_pair = it_index->second.equal_range(index);
+			for (auto it = index_pair.first; it != index_pair.second; ++it)
+			{
+				if (IsAddressOverlapping(it->second.address, dirty_address))
+					dirty_views.push_back(it->second.view);
+			}
+		}
+	}
+}
+
+bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables, const Vector<DataAddress>& dirty_addresses, double deadline,
+	DataModelStatistics& statistics)
 {
 	bool result = false;
 
+	SystemInterface* system_interface = GetSystemInterface();
+	if (!system_interface)
+		deadline = 0;
+
+	Vector<DataView*> previously_deferred_views;
+	std::swap(previously_deferred_views, deferred_views);
+	std::sort(previously_deferred_views.begin(), previously_deferred_views.end());
+
 	// View updates may result in newly added views, thus we do it recursively but with an upper limit.
 	//   Without the loop, newly added views won't be updated until the next Update() call.
 	for(int i = 0; i == 0 || (!views_to_add.empty() && i < 10); i++)
 	{
 		Vector<DataView*> dirty_views;
 
+		// The first update of a view is never deferred, otherwise its element would show unprocessed contents such as
+		// the raw text of '{{ }}' expressions.
+		Vector<DataView*> new_views;
+
 		if (!views_to_add.empty())
 		{
 			views.reserve(views.size() + views_to_add.size());
 			for (auto&& view : views_to_add)
 			{
 				dirty_views.push_back(view.get());
-				for (const String& variable_name : view->GetVariableNameList())
-					name_view_map.emplace(variable_name, view.get());
+				new_views.push_back(view.get());
+				RegisterAddresses(view.get());
 
 				views.push_back(std::move(view));
 			}
 			views_to_add.clear();
+			std::sort(new_views.begin(), new_views.end());
 		}
 
-		for (const String& variable_name : dirty_variables)
+		// The dirty variables and addresses are handled in the first iteration, later iterations only update the new views.
+		if (i == 0)
 		{
-			auto pair = name_view_map.equal_range(variable_name);
-			for (auto it = pair.first; it != pair.second; ++it)
-				dirty_views.push_back(it->second);
+			GatherDirtyViews(dirty_views, dirty_variables, dirty_addresses);
+
+			// Views may request another update while being updated, those are kept for the next update.
+			dirty_views.insert(dirty_views.end(), requested_views.begin(), requested_views.end());
+			requested_views.clear();
+
+			dirty_views.insert(dirty_views.end(), previously_deferred_views.begin(), previously_deferred_views.end());
 		}
 
 		// Remove duplicate entries
@@ -131,24 +310,26 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 			if (!view)
 				continue;
 
-			if (view->IsValid())
-				result |= view->Update(model);
+			if (!view->IsValid())
+				continue;
+
+			if (deadline > 0 && !view->IsStructural() && !std::binary_search(previously_deferred_views.begin(), previously_deferred_views.end(), view) &&
+				!std::binary_search(new_views.begin(), new_views.end(), view) && system_interface->GetElapsedTime() >= deadline)
+			{
+				deferred_views.push_back(view);
+				statistics.num_views_deferred += 1;
+				continue;
+			}
+
+			result |= view->Update(model);
+			statistics.num_views_updated += 1;
 		}
 
-		// Destroy views marked for destruction
-		// @performance: Horrible...
+		// Destroy views marked for destruction, looking up only the entries of the addresses they were registered with.
 		if (!views_to_remove.empty())
 		{
 			for (const auto& view : views_to_remove)
-			{
-				for (auto it = name_view_map.begin(); it != name_view_map.end(); )
-				{
-					if (it->second == view.get())
-						it = name_view_map.erase(it);
-					else
-						++it;
-				}
-			}
+				UnregisterAddresses(view.get());
 
 			views_to_remove.clear();
 		}
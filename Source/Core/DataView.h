@@ -38,6 +38,9 @@ namespace Rml {
 
 class Element;
 class DataModel;
+struct DataAddressMove;
+using DataAddressMoveList = Vector<DataAddressMove>;
+using ElementAddressMoves = UnorderedMap<Element*, DataAddressMoveList>;
 
 
 class DataViewInstancer : public NonCopyMoveable {
@@ -82,8 +85,15 @@ public:
 	// Returns true if the update resulted in a document change.
 	virtual bool Update(DataModel& model) = 0;
 
-	// Returns the list of data variable name(s) which can modify this view.
-	virtual StringList GetVariableNameList() const = 0;
+	// Returns the list of data variable address(es) which can modify this view.
+	virtual Vector<DataAddress> GetVariableAddressList() const = 0;
+
+	// Move the addresses read by this view, such as when its 'data-for' entry is moved to a new index.
+	// Returns true if any address changed.
+	virtual bool MoveAddresses(const DataAddressMoveList& /*moves*/) { return false; }
+
+	// Structural views create and remove elements, their updates are never deferred by the update budget.
+	virtual bool IsStructural() const { return false; }
 
 	// Returns the attached element if it still exists.
 	Element* GetElement() const;
@@ -111,11 +121,27 @@ public:
 
 	void Add(DataViewPtr view);
 
+	// Update the given view during the next update.
+	void DirtyView(DataView* view);
+
 	void OnElementRemove(Element* element);
 
-	bool Update(DataModel& model, const DirtyVariables& dirty_variables);
+	// Move the addresses of the views attached to the given elements or their descendants. Views whose results may
+	// change by the move are updated immediately.
+	void MoveAddresses(DataModel& model, const ElementAddressMoves& element_moves);
+
+	// Update the views reading any of the dirty variables, or reading any part of the dirty addresses. Once the elapsed time
+	// reaches a non-zero deadline, the remaining non-structural views are deferred to the next update. Views added since the
+	// last update are always updated.
+	bool Update(DataModel& model, const DirtyVariables& dirty_variables, const Vector<DataAddress>& dirty_addresses, double deadline,
+		DataModelStatistics& statistics);
 
 private:
+	void RegisterAddresses(DataView* view);
+	void UnregisterAddresses(DataView* view);
+
+	void GatherDirtyViews(Vector<DataView*>& dirty_views, const DirtyVariables& dirty_variables, const Vector<DataAddress>& dirty_addresses) const;
+
 	using DataViewList = Vector<DataViewPtr>;
 
 	DataViewList views;
@@ -123,8 +149,22 @@ private:
 	DataViewList views_to_add;
 	DataViewList views_to_remove;
 
-	using NameViewMap = UnorderedMultimap<String, DataView*>;
+	Vector<DataView*> requested_views;
+	// Views not updated before the deadline of the previous update. They are never deferred again.
+	Vector<DataView*> deferred_views;
+
+	struct AddressView {
+		DataAddress address;
+		DataView* view;
+	};
+
+	// Views reading a variable as a whole, or by any address not starting with a constant index.
+	using NameViewMap = UnorderedMultimap<String, AddressView>;
 	NameViewMap name_view_map;
+
+	// Views reading an element of an array variable, such as the views generated by 'data-for', keyed by the variable name and array index.
+	using IndexViewMap = UnorderedMap<String, UnorderedMultimap<int, AddressView>>;
+	IndexViewMap index_view_map;
 };
 
 } // namespace Rml
@@ -29,8 +29,11 @@
 #include "DataViewDefault.h"
 #include "DataExpression.h"
 #include "DataModel.h"
+#include "DataTemplate.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/ElementText.h"
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
@@ -38,6 +41,33 @@
 
 namespace Rml {
 
+// Compares the string representations of two variants, avoiding string copies when both already hold strings.
+static bool VariantEqualsString(const Variant& a, const Variant& b)
+{
+	if (a.GetType() == Variant::STRING && b.GetType() == Variant::STRING)
+		return a.GetReference<String>() == b.GetReference<String>();
+	return a.Get<String>() == b.Get<String>();
+}
+
+// Assigns the string representation of the variant to the target, reusing its capacity. Returns true if the target was changed.
+static bool AssignVariantString(String& target, const Variant& variant)
+{
+	if (variant.GetType() == Variant::STRING)
+	{
+		const String& value = variant.GetReference<String>();
+		if (target == value)
+			return false;
+		target.assign(value);
+		return true;
+	}
+
+	String value = variant.Get<String>();
+	if (target == value)
+		return false;
+	target = std::move(value);
+	return true;
+}
+
 DataViewCommon::DataViewCommon(Element* element, String override_modifier) : DataView(element), modifier(std::move(override_modifier))
 {}
 
@@ -54,9 +84,14 @@ bool DataViewCommon::Initialize(DataModel& model, Element* element, const String
 	return result;
 }
 
-StringList DataViewCommon::GetVariableNameList() const {
+Vector<DataAddress> DataViewCommon::GetVariableAddressList() const {
 	RMLUI_ASSERT(expression);
-	return expression->GetVariableNameList();
+	return expression->GetVariableAddressList();
+}
+
+bool DataViewCommon::MoveAddresses(const DataAddressMoveList& moves) {
+	RMLUI_ASSERT(expression);
+	return expression->MoveAddresses(moves);
 }
 
 const String& DataViewCommon::GetModifier() const {
@@ -90,12 +125,11 @@ bool DataViewAttribute::Update(DataModel& model)
 
 	if (element && GetExpression().Run(expr_interface, variant))
 	{
-		const String value = variant.Get<String>();
 		const Variant* attribute = element->GetAttribute(attribute_name);
-		
-		if (!attribute || (attribute && attribute->Get<String>() != value))
+
+		if (!attribute || !VariantEqualsString(*attribute, variant))
 		{
-			element->SetAttribute(attribute_name, value);
+			element->SetAttribute(attribute_name, variant.Get<String>());
 			result = true;
 		}
 	}
@@ -187,11 +221,12 @@ bool DataViewStyle::Update(DataModel& model)
 	
 	if (element && GetExpression().Run(expr_interface, variant))
 	{
-		const String value = variant.Get<String>();
-		const Property* p = element->GetLocalProperty(property_name);
-		if (!p || p->Get<String>() != value)
+		// Compare against the last applied value, as parsed properties may not convert back to the same string.
+		String value = variant.Get<String>();
+		if (value != previous_value || !element->GetLocalProperty(property_name))
 		{
 			element->SetProperty(property_name, value);
+			previous_value = std::move(value);
 			result = true;
 		}
 	}
@@ -364,12 +399,8 @@ bool DataViewText::Update(DataModel& model)
 			RMLUI_ASSERT(entry.data_expression);
 			Variant variant;
 			bool result = entry.data_expression->Run(expression_interface, variant);
-			const String value = variant.Get<String>();
-			if (result && entry.value != value)
-			{
-				entry.value = value;
+			if (result && AssignVariantString(entry.value, variant))
 				entries_modified = true;
-			}
 		}
 	}
 
@@ -381,12 +412,17 @@ bool DataViewText::Update(DataModel& model)
 
 			if (ElementText* text_element = static_cast<ElementText*>(element))
 			{
-				String new_text = BuildText();
+				BuildText(text_buffer);
 
-				String text;
 				if (SystemInterface* system_interface = GetSystemInterface())
-					system_interface->TranslateString(text, new_text);
-				text_element->SetText(text);
+				{
+					system_interface->TranslateString(translated_buffer, text_buffer);
+					text_element->SetText(translated_buffer);
+				}
+				else
+				{
+					text_element->SetText(text_buffer);
+				}
 			}
 		}
 		else
@@ -398,57 +434,70 @@ bool DataViewText::Update(DataModel& model)
 	return entries_modified;
 }
 
-StringList DataViewText::GetVariableNameList() const
+Vector<DataAddress> DataViewText::GetVariableAddressList() const
 {
-	StringList full_list;
+	Vector<DataAddress> full_list;
 	full_list.reserve(data_entries.size());
 
 	for (const DataEntry& entry : data_entries)
 	{
 		RMLUI_ASSERT(entry.data_expression);
 
-		StringList entry_list = entry.data_expression->GetVariableNameList();
-		full_list.insert(full_list.end(),
-			MakeMoveIterator(entry_list.begin()),
-			MakeMoveIterator(entry_list.end())
-		);
+		const AddressList& entry_list = entry.data_expression->GetVariableAddressList();
+		full_list.insert(full_list.end(), entry_list.begin(), entry_list.end());
 	}
 
 	return full_list;
 }
 
+bool DataViewText::MoveAddresses(const DataAddressMoveList& moves)
+{
+	bool result = false;
+	for (DataEntry& entry : data_entries)
+	{
+		RMLUI_ASSERT(entry.data_expression);
+		result |= entry.data_expression->MoveAddresses(moves);
+	}
+	return result;
+}
+
 void DataViewText::Release()
 {
 	delete this;
 }
 
-String DataViewText::BuildText() const
+void DataViewText::BuildText(String& out_text) const
 {
 	size_t reserve_size = text.size();
 
 	for (const DataEntry& entry : data_entries)
 		reserve_size += entry.value.size();
 
-	String result;
-	result.reserve(reserve_size);
+	// Build in place to keep the capacity of the output buffer between updates.
+	out_text.clear();
+	out_text.reserve(reserve_size);
 
 	size_t previous_index = 0;
 	for (const DataEntry& entry : data_entries)
 	{
-		result += text.substr(previous_index, entry.index - previous_index);
-		result += entry.value;
+		out_text.append(text, previous_index, entry.index - previous_index);
+		out_text += entry.value;
 		previous_index = entry.index;
 	}
 
 	if (previous_index < text.size())
-		result += text.substr(previous_index);
-
-	return result;
+		out_text.append(text, previous_index, String::npos);
 }
 
 
 
 DataViewFor::DataViewFor(Element* element) : DataView(element)
+{
+	static int next_index_literal_id = 0;
+	index_literal_id = next_index_literal_id++;
+}
+
+DataViewFor::~DataViewFor()
 {}
 
 bool DataViewFor::Initialize(DataModel& model, Element* element, const String& in_expression, const String& in_rml_content)
@@ -497,19 +546,42 @@ bool DataViewFor::Initialize(DataModel& model, Element* element, const String& i
 	if (container_address.empty())
 		return false;
 
-	element->SetProperty(PropertyId::Display, Property(Style::Display::None));
-
-	// Copy over the attributes, but remove the 'data-for' which would otherwise recreate the data-for loop on all constructed children recursively.
-	attributes = element->GetAttributes();
-	for (auto it = attributes.begin(); it != attributes.end(); ++it)
+	// Entries are matched by their key instead of their index when the 'data-key' attribute is set, such as 'data-key="it.id"'.
+	// Resolve the key against the first entry, and keep only its address relative to the entry.
+	const String key_name = element->GetAttribute<String>("data-key", "");
+	if (!key_name.empty())
 	{
-		if (it->first == "data-for")
+		DataAddress iterator_address = container_address;
+		iterator_address.push_back(DataAddressEntry(0));
+		model.InsertAlias(element, iterator_name, std::move(iterator_address));
+		DataAddress address = model.ResolveAddress(key_name, element);
+		model.EraseAliases(element);
+
+		const size_t entry_address_size = container_address.size() + 1;
+		const bool is_entry_address = (address.size() > entry_address_size && std::equal(container_address.begin(), container_address.end(), address.begin(),
+			[](const DataAddressEntry& a, const DataAddressEntry& b) { return a.index == b.index && a.name == b.name; }));
+		if (!is_entry_address)
 		{
-			attributes.erase(it);
-			break;
+			Log::Message(Log::LT_WARNING, "The data-key '%s' must refer to a member of the '%s' iterator in data-for '%s'", key_name.c_str(),
+				iterator_name.c_str(), in_expression.c_str());
+			return false;
 		}
+
+		key_address.assign(address.begin() + entry_address_size, address.end());
 	}
 
+	element->SetProperty(PropertyId::Display, Property(Style::Display::None));
+
+	// Parse the contents once here, so that each generated element can be constructed without going through the XML parser.
+	Context* context = element->GetContext();
+	rml_template = DataTemplate::Compile(rml_contents, context ? context->GetDocumentsBaseTag() : "body");
+
+	// Copy over the attributes, but remove the 'data-for' which would otherwise recreate the data-for loop on all constructed children recursively.
+	attributes = element->GetAttributes();
+	for (const String& name : Factory::GetStructuralDataViewAttributeNames())
+		attributes.erase(name);
+	attributes.erase("data-key");
+
 	return true;
 }
 
@@ -520,6 +592,9 @@ bool DataViewFor::Update(DataModel& model)
 	if (!variable)
 		return false;
 
+	if (!key_address.empty())
+		return UpdateKeyed(model, variable);
+
 	bool result = false;
 	const int size = variable.Size();
 	const int num_elements = (int)elements.size();
@@ -529,32 +604,16 @@ bool DataViewFor::Update(DataModel& model)
 	{
 		if (i >= num_elements)
 		{
-			ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
-
-			DataAddress iterator_address;
-			iterator_address.reserve(container_address.size() + 1);
-			iterator_address = container_address;
-			iterator_address.push_back(DataAddressEntry(i));
-
-			DataAddress iterator_index_address = {
-				{"literal"}, {"int"}, {i}
-			};
-
-			model.InsertAlias(new_element_ptr.get(), iterator_name, std::move(iterator_address));
-			model.InsertAlias(new_element_ptr.get(), iterator_index_name, std::move(iterator_index_address));
-
-			Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), element);
-			elements.push_back(new_element);
-
-			elements[i]->SetInnerRML(rml_contents);
+			elements.push_back(InstanceRow(model, i, element));
+			result = true;
 
 			RMLUI_ASSERT(i < (int)elements.size());
 		}
 		if (i >= size)
 		{
-			model.EraseAliases(elements[i]);
-			elements[i]->GetParentNode()->RemoveChild(elements[i]).reset();
+			RemoveRow(model, elements[i]);
 			elements[i] = nullptr;
+			result = true;
 		}
 	}
 
@@ -564,9 +623,146 @@ bool DataViewFor::Update(DataModel& model)
 	return result;
 }
 
-StringList DataViewFor::GetVariableNameList() const {
+bool DataViewFor::UpdateKeyed(DataModel& model, DataVariable variable)
+{
+	const int size = variable.Size();
+	const int num_elements = (int)elements.size();
+	Element* element = GetElement();
+	Element* parent = element->GetParentNode();
+
+	StringList new_keys(size);
+	for (int i = 0; i < size; i++)
+	{
+		DataVariable key_variable = variable.Child(DataAddressEntry(i));
+		for (const DataAddressEntry& entry : key_address)
+		{
+			if (!key_variable)
+				break;
+			key_variable = key_variable.Child(entry);
+		}
+
+		Variant key;
+		if (key_variable && key_variable.Get(key))
+			new_keys[i] = key.Get<String>();
+	}
+
+	// Find the previous element of each key, only the first element of duplicate keys is reused.
+	UnorderedMap<String, int> previous_indices;
+	previous_indices.reserve(num_elements);
+	for (int i = 0; i < num_elements; i++)
+	{
+		if (!keys[i].empty())
+			previous_indices.emplace(keys[i], i);
+	}
+
+	bool result = false;
+	ElementList new_elements(size, nullptr);
+	Vector<bool> element_reused(num_elements, false);
+	ElementAddressMoves element_moves;
+
+	for (int i = 0; i < size; i++)
+	{
+		auto it = previous_indices.find(new_keys[i]);
+		if (it == previous_indices.end())
+			continue;
+
+		const int previous_index = it->second;
+		previous_indices.erase(it);
+
+		new_elements[i] = elements[previous_index];
+		element_reused[previous_index] = true;
+
+		if (previous_index != i)
+		{
+			DataAddress from = container_address;
+			from.push_back(DataAddressEntry(previous_index));
+			DataAddress to = container_address;
+			to.push_back(DataAddressEntry(i));
+
+			DataAddressMoveList& moves = element_moves[elements[previous_index]];
+			moves.push_back(DataAddressMove{ std::move(from), std::move(to) });
+			moves.push_back(DataAddressMove{ GetIndexAddress(previous_index), GetIndexAddress(i) });
+		}
+	}
+
+	for (int i = 0; i < num_elements; i++)
+	{
+		if (!element_reused[i])
+		{
+			RemoveRow(model, elements[i]);
+			result = true;
+		}
+	}
+
+	if (!element_moves.empty())
+		result = true;
+
+	model.MoveAddresses(element_moves);
+
+	// Put the elements in order, from the back so that each element can be placed in front of its successor.
+	Element* next_element = element;
+	for (int i = size - 1; i >= 0; i--)
+	{
+		if (new_elements[i])
+		{
+			parent->MoveChildBefore(new_elements[i], next_element);
+		}
+		else
+		{
+			new_elements[i] = InstanceRow(model, i, next_element);
+			result = true;
+		}
+
+		next_element = new_elements[i];
+	}
+
+	elements = std::move(new_elements);
+	keys = std::move(new_keys);
+
+	return result;
+}
+
+Element* DataViewFor::InstanceRow(DataModel& model, int index, Element* insert_before)
+{
+	Element* element = GetElement();
+	ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
+
+	DataAddress iterator_address;
+	iterator_address.reserve(container_address.size() + 1);
+	iterator_address = container_address;
+	iterator_address.push_back(DataAddressEntry(index));
+
+	model.InsertAlias(new_element_ptr.get(), iterator_name, std::move(iterator_address));
+	model.InsertAlias(new_element_ptr.get(), iterator_index_name, GetIndexAddress(index));
+
+	Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), insert_before);
+
+	if (rml_template)
+		rml_template->Instance(new_element);
+	else
+		new_element->SetInnerRML(rml_contents);
+
+	return new_element;
+}
+
+void DataViewFor::RemoveRow(DataModel& model, Element* row)
+{
+	model.EraseAliases(row);
+	row->GetParentNode()->RemoveChild(row).reset();
+}
+
+DataAddress DataViewFor::GetIndexAddress(int index) const
+{
+	return DataAddress{ {"literal"}, {"int"}, {index}, {index_literal_id} };
+}
+
+Vector<DataAddress> DataViewFor::GetVariableAddressList() const {
 	RMLUI_ASSERT(!container_address.empty());
-	return StringList{ container_address.front().name };
+	return Vector<DataAddress>{ container_address };
+}
+
+bool DataViewFor::MoveAddresses(const DataAddressMoveList& moves) {
+	return MoveDataAddress(container_address, moves);
 }
 
 void DataViewFor::Release()
@@ -574,4 +770,195 @@ void DataViewFor::Release()
 	delete this;
 }
 
+
+// Number of entries instanced before the entry height is known.
+static constexpr int virtual_for_initial_rows = 16;
+// Number of entries instanced above and below the viewport.
+static constexpr int virtual_for_overscan_rows = 4;
+
+// Sets the height of a spacer element, returns true if it changed.
+static bool SetSpacerHeight(Element* spacer, float height)
+{
+	const Property height_property(height, Property::PX);
+	const Property* previous_height = spacer->GetLocalProperty(PropertyId::Height);
+	if (previous_height && *previous_height == height_property)
+		return false;
+
+	spacer->SetProperty(PropertyId::Height, height_property);
+	return true;
+}
+
+DataViewVirtualFor::DataViewVirtualFor(Element* element) : DataViewFor(element)
+{}
+
+DataViewVirtualFor::~DataViewVirtualFor()
+{
+	if (Element* container = scroll_container.get())
+		container->RemoveEventListener(EventId::Scroll, this);
+	if (Element* document_element = document.get())
+		document_element->RemoveEventListener(EventId::Resize, this);
+
+	for (Element* spacer : { spacer_before.get(), spacer_after.get() })
+	{
+		if (spacer && spacer->GetParentNode())
+			spacer->GetParentNode()->RemoveChild(spacer);
+	}
+}
+
+bool DataViewVirtualFor::Initialize(DataModel& model, Element* element, const String& in_expression, const String& in_rml_content)
+{
+	if (!DataViewFor::Initialize(model, element, in_expression, in_rml_content))
+		return false;
+
+	Element* parent = element->GetParentNode();
+	if (!parent)
+	{
+		Log::Message(Log::LT_WARNING, "Could not find a scroll container for data-virtualfor '%s'", in_expression.c_str());
+		return false;
+	}
+
+	scroll_container = parent->GetObserverPtr();
+	parent->AddEventListener(EventId::Scroll, this);
+
+	if (ElementDocument* document_element = element->GetOwnerDocument())
+	{
+		document = document_element->GetObserverPtr();
+		document_element->AddEventListener(EventId::Resize, this);
+	}
+
+	return true;
+}
+
+bool DataViewVirtualFor::Update(DataModel& model)
+{
+	DataVariable variable = model.GetVariable(container_address);
+	Element* element = GetElement();
+	Element* container = scroll_container.get();
+	if (!variable || !element || !container)
+		return false;
+
+	const int size = variable.Size();
+	bool result = false;
+
+	if (!spacer_before || !spacer_after)
+	{
+		for (ObserverPtr<Element>* spacer : { &spacer_before, &spacer_after })
+		{
+			if (*spacer)
+				continue;
+
+			// Local properties override any universal rules of the document which could change the height of the spacer.
+			ElementPtr spacer_ptr = Factory::InstanceElement(nullptr, "*", "#spacer", XMLAttributes());
+			spacer_ptr->SetProperty(PropertyId::Display, Property(Style::Display::Block));
+			spacer_ptr->SetProperty(PropertyId::BoxSizing, Property(Style::BoxSizing::ContentBox));
+			for (const char* name : { "margin", "padding", "border-width", "min-height" })
+				spacer_ptr->SetProperty(name, "0px");
+			spacer_ptr->SetProperty(PropertyId::MaxHeight, Property(-1.f, Property::PX));
+			*spacer = element->GetParentNode()->InsertBefore(std::move(spacer_ptr), element)->GetObserverPtr();
+		}
+		result = true;
+	}
+
+	Element* before = spacer_before.get();
+	Element* after = spacer_after.get();
+
+	// Estimate the entry height from the entries formatted since the last update.
+	const float previous_row_height = row_height;
+	float total_height = 0.f;
+	int num_measured_rows = 0;
+	for (Element* row : rows)
+	{
+		const float height = row->GetBox().GetSize(Box::MARGIN).y;
+		if (height > 0.f)
+		{
+			total_height += height;
+			num_measured_rows += 1;
+		}
+	}
+	if (num_measured_rows > 0)
+		row_height = total_height / float(num_measured_rows);
+
+	// Find the range of entries visible in the viewport of the container.
+	int begin = 0;
+	int end = Math::Min(size, virtual_for_initial_rows);
+
+	const float viewport_height = container->GetClientHeight();
+	if (row_height > 0.f && viewport_height > 0.f)
+	{
+		const float scroll_top = container->GetScrollTop();
+		const float origin = before->GetAbsoluteOffset(Box::BORDER).y - container->GetAbsoluteOffset(Box::PADDING).y + scroll_top;
+		// The scroll offset is clamped by the container during layout, thus also clamp it here in case the container shrinks.
+		const float viewport_top = Math::Clamp(scroll_top - origin, 0.f, Math::Max(float(size) * row_height - viewport_height, 0.f));
+
+		begin = Math::Clamp(int(viewport_top / row_height) - virtual_for_overscan_rows, 0, size);
+		end = Math::Clamp(int((viewport_top + viewport_height) / row_height) + 1 + virtual_for_overscan_rows, begin, size);
+	}
+
+	// Remove the entries outside the new range.
+	if (begin >= rows_begin + (int)rows.size() || end <= rows_begin)
+	{
+		for (Element* row : rows)
+			RemoveRow(model, row);
+		result |= !rows.empty();
+		rows.clear();
+	}
+	else
+	{
+		int num_remove_front = Math::Max(begin - rows_begin, 0);
+		for (int i = 0; i < num_remove_front; i++)
+			RemoveRow(model, rows[i]);
+		rows.erase(rows.begin(), rows.begin() + num_remove_front);
+		rows_begin += num_remove_front;
+		result |= (num_remove_front > 0);
+
+		while (rows_begin + (int)rows.size() > end)
+		{
+			RemoveRow(model, rows.back());
+			rows.pop_back();
+			result = true;
+		}
+	}
+
+	if (rows.empty())
+		rows_begin = begin;
+
+	// Instance the new entries, keeping the rows in document order.
+	bool rows_added = false;
+	if (begin < rows_begin)
+	{
+		ElementList new_rows;
+		new_rows.reserve(rows_begin - begin);
+		for (int i = begin; i < rows_begin; i++)
+			new_rows.push_back(InstanceRow(model, i, rows.front()));
+
+		rows.insert(rows.begin(), new_rows.begin(), new_rows.end());
+		rows_begin = begin;
+		rows_added = true;
+	}
+
+	for (int i = rows_begin + (int)rows.size(); i < end; i++)
+	{
+		rows.push_back(InstanceRow(model, i, after));
+		rows_added = true;
+	}
+
+	result |= SetSpacerHeight(before, float(begin) * row_height);
+	result |= SetSpacerHeight(after, float(size - end) * row_height);
+
+	// Check the range again once the new entries have been formatted, as long as they change the estimated entry height.
+	if (rows_added && (row_height == 0.f || row_height != previous_row_height))
+		model.DirtyView(this);
+
+	return result || rows_added;
+}
+
+void DataViewVirtualFor::ProcessEvent(Event& /*event*/)
+{
+	if (Element* element = GetElement())
+	{
+		if (DataModel* model = element->GetDataModel())
+			model->DirtyView(this);
+	}
+}
+
 } // namespace Rml
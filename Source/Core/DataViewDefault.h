@@ -31,6 +31,7 @@
 
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/EventListener.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataView.h"
 
@@ -38,6 +39,7 @@ namespace Rml {
 
 class Element;
 class DataExpression;
+class DataTemplate;
 using DataExpressionPtr = UniquePtr<DataExpression>;
 
 
@@ -47,7 +49,9 @@ public:
 
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
-	StringList GetVariableNameList() const override;
+	Vector<DataAddress> GetVariableAddressList() const override;
+
+	bool MoveAddresses(const DataAddressMoveList& moves) override;
 
 protected:
 	const String& GetModifier() const;
@@ -94,6 +98,9 @@ public:
 	DataViewStyle(Element* element);
 
 	bool Update(DataModel& model) override;
+
+private:
+	String previous_value;
 };
 
 
@@ -139,13 +146,16 @@ public:
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
 	bool Update(DataModel& model) override;
-	StringList GetVariableNameList() const override;
+	Vector<DataAddress> GetVariableAddressList() const override;
+
+	bool MoveAddresses(const DataAddressMoveList& moves) override;
 
 protected:
 	void Release() override;
 
 private:
-	String BuildText() const;
+	// Builds the text from its literal segments and the current entry values, reusing the capacity of the output string.
+	void BuildText(String& out_text) const;
 
 	struct DataEntry {
 		size_t index = 0; // Index into 'text'
@@ -155,30 +165,95 @@ private:
 
 	String text;
 	Vector<DataEntry> data_entries;
+
+	// Scratch buffers kept between updates to avoid reallocating the generated text.
+	String text_buffer;
+	String translated_buffer;
 };
 
 
-class DataViewFor final : public DataView {
+class DataViewFor : public DataView {
 public:
 	DataViewFor(Element* element);
+	~DataViewFor();
 
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& inner_rml) override;
 
 	bool Update(DataModel& model) override;
 
-	StringList GetVariableNameList() const override;
+	Vector<DataAddress> GetVariableAddressList() const override;
+
+	bool MoveAddresses(const DataAddressMoveList& moves) override;
+
+	bool IsStructural() const override { return true; }
 
 protected:
 	void Release() override;
 
-private:
+	// Instance the contents for the container entry at the given index, inserted before the given sibling.
+	Element* InstanceRow(DataModel& model, int index, Element* insert_before);
+	void RemoveRow(DataModel& model, Element* row);
+
 	DataAddress container_address;
+
+private:
 	String iterator_name;
 	String iterator_index_name;
 	String rml_contents;
+	UniquePtr<DataTemplate> rml_template;
 	ElementAttributes attributes;
 
+	// Address of the 'data-key' variable relative to each container entry, entries are not keyed when empty.
+	DataAddress key_address;
+	StringList keys;
+
 	ElementList elements;
+
+	// Identifies the index literals of this loop, so that moving the rows of a loop leaves the index of nested loops alone.
+	int index_literal_id = 0;
+
+	bool UpdateKeyed(DataModel& model, DataVariable variable);
+
+	// Returns the address of the literal index alias for the row at the given index.
+	DataAddress GetIndexAddress(int index) const;
+};
+
+
+/**
+	Virtualized 'data-for' view, declared by the 'data-virtualfor' attribute with the same syntax as 'data-for'.
+
+	Only the entries inside the scroll viewport of the parent element, plus a few entries of overscan, are instanced.
+	Elements before and after the instanced entries are sized by the estimated entry height so that the scrollbars
+	still cover the whole container. All entries are expected to have the same, or a similar, height.
+ */
+
+class DataViewVirtualFor final : public DataViewFor, private EventListener {
+public:
+	DataViewVirtualFor(Element* element);
+	~DataViewVirtualFor();
+
+	bool Initialize(DataModel& model, Element* element, const String& expression, const String& inner_rml) override;
+
+	bool Update(DataModel& model) override;
+
+protected:
+	// Responds to 'scroll' events on the parent and 'resize' events on the document.
+	void ProcessEvent(Event& event) override;
+
+private:
+	ObserverPtr<Element> scroll_container;
+	ObserverPtr<Element> document;
+
+	// Spacers taking the place of the entries not instanced. They use a private tag so that they are not styled by the
+	// document, and are removed together with the view.
+	ObserverPtr<Element> spacer_before;
+	ObserverPtr<Element> spacer_after;
+
+	// Entries in the range [rows_begin, rows_begin + rows.size()) are instanced.
+	int rows_begin = 0;
+	ElementList rows;
+
+	float row_height = 0.f;
 };
 
 } // namespace Rml
@@ -67,11 +67,8 @@ DecoratorDataHandle DecoratorNinePatch::GenerateElementData(Element* element) co
 
 	const Vector2f surface_dimensions = element->GetBox().GetSize(Box::PADDING);
 
-	const float opacity = computed.opacity;
-	Colourb quad_colour = computed.image_color;
-
-	quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
-
+	// Opacity is applied when rendering.
+	const Colourb quad_colour = computed.image_color;
 
 	/* In the following, we operate on the four diagonal vertices in the grid, as they define the whole grid. */
 
@@ -170,7 +167,7 @@ void DecoratorNinePatch::ReleaseElementData(DecoratorDataHandle element_data) co
 void DecoratorNinePatch::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
 	Geometry* data = reinterpret_cast< Geometry* >(element_data);
-	data->Render(element->GetAbsoluteOffset(Box::PADDING).Round());
+	data->Render(element->GetAbsoluteOffset(Box::PADDING).Round(), element->GetComputedValues().opacity);
 }
 
 
@@ -113,11 +113,8 @@ void DecoratorTiled::Tile::GenerateGeometry(Vector< Vertex >& vertices, Vector<
 	RenderInterface* render_interface = element->GetRenderInterface();
 	const auto& computed = element->GetComputedValues();
 
-	float opacity = computed.opacity;
-	Colourb quad_colour = computed.image_color;
-
-    // Apply opacity
-    quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
+	// Opacity is applied when rendering.
+	const Colourb quad_colour = computed.image_color;
 
 	auto data_iterator = data.find(render_interface);
 	if (data_iterator == data.end())
@@ -289,10 +289,11 @@ void DecoratorTiledBox::ReleaseElementData(DecoratorDataHandle element_data) con
 void DecoratorTiledBox::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
 	Vector2f translation = element->GetAbsoluteOffset(Box::PADDING).Round();
+	const float opacity = element->GetComputedValues().opacity;
 	DecoratorTiledBoxData* data = reinterpret_cast< DecoratorTiledBoxData* >(element_data);
 
 	for (int i = 0; i < data->num_textures; i++)
-		data->geometry[i].Render(translation);
+		data->geometry[i].Render(translation, opacity);
 }
 
 } // namespace Rml
@@ -148,10 +148,11 @@ void DecoratorTiledHorizontal::ReleaseElementData(DecoratorDataHandle element_da
 void DecoratorTiledHorizontal::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
 	Vector2f translation = element->GetAbsoluteOffset(Box::PADDING).Round();
+	const float opacity = element->GetComputedValues().opacity;
 	DecoratorTiledHorizontalData* data = reinterpret_cast< DecoratorTiledHorizontalData* >(element_data);
 
 	for (int i = 0; i < data->num_textures; i++)
-		data->geometry[i].Render(translation);
+		data->geometry[i].Render(translation, opacity);
 }
 
 } // namespace Rml
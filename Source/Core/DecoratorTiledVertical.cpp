@@ -149,10 +149,11 @@ void DecoratorTiledVertical::ReleaseElementData(DecoratorDataHandle element_data
 void DecoratorTiledVertical::RenderElement(Element* element, DecoratorDataHandle element_data) const
 {
 	Vector2f translation = element->GetAbsoluteOffset(Box::PADDING).Round();
+	const float opacity = element->GetComputedValues().opacity;
 	DecoratorTiledVerticalData* data = reinterpret_cast< DecoratorTiledVerticalData* >(element_data);
 
 	for (int i = 0; i < data->num_textures; i++)
-		data->geometry[i].Render(translation);
+		data->geometry[i].Render(translation, opacity);
 }
 
 } // namespace Rml
@@ -52,6 +52,7 @@
 #include "EventDispatcher.h"
 #include "EventSpecification.h"
 #include "ElementDecoration.h"
+#include "HitTestGrid.h"
 #include "LayoutEngine.h"
 #include "PluginRegistry.h"
 #include "PropertiesIterator.h"
@@ -84,6 +85,15 @@ struct ElementMeta
 
 static Pool< ElementMeta > element_meta_chunk_pool(200, true);
 
+static void DirtyDamageRegionRecursive(Element* element)
+{
+	element->DirtyDamageRegion();
+
+	const int num_children = element->GetNumChildren(true);
+	for (int i = 0; i < num_children; i++)
+		DirtyDamageRegionRecursive(element->GetChild(i));
+}
+
 
 /// Constructs a new RmlUi element.
 Element::Element(const String& tag) : tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0), absolute_offset(0, 0), scroll_offset(0, 0), content_offset(0, 0), content_box(0, 0), 
@@ -103,6 +113,8 @@ transform_state(), dirty_transform(false), dirty_perspective(false), dirty_anima
 
 	baseline = 0.0f;
 
+	layout_boundary = false;
+
 	num_non_dom_children = 0;
 
 	visible = true;
@@ -115,6 +127,11 @@ transform_state(), dirty_transform(false), dirty_perspective(false), dirty_anima
 
 	structure_dirty = false;
 
+	dirty_update = true;
+	dirty_update_descendants = false;
+
+	dirty_damage_region = false;
+
 	computed_values_are_default_initialized = true;
 
 	meta = element_meta_chunk_pool.AllocateAndConstruct(this);
@@ -145,34 +162,52 @@ Element::~Element()
 
 void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 {
+	// Skip clean subtrees entirely.
+	if (!dirty_update && !dirty_update_descendants)
+		return;
+
 #ifdef RMLUI_ENABLE_PROFILING
 	auto name = GetAddress(false, false);
 	RMLUI_ZoneScoped;
 	RMLUI_ZoneText(name.c_str(), name.size());
 #endif
 
-	OnUpdate();
-
-	UpdateStructure();
-
-	HandleTransitionProperty();
-	HandleAnimationProperty();
-	AdvanceAnimations();
+	if (dirty_update)
+	{
+		dirty_update = false;
 
-	meta->scroll.Update();
+		OnUpdate();
 
-	UpdateProperties(dp_ratio, vp_dimensions);
+		UpdateStructure();
 
-	// Do en extra pass over the animations and properties if the 'animation' property was just changed.
-	if (dirty_animation)
-	{
+		HandleTransitionProperty();
 		HandleAnimationProperty();
 		AdvanceAnimations();
+
+		meta->scroll.Update();
+
 		UpdateProperties(dp_ratio, vp_dimensions);
+
+		// Do en extra pass over the animations and properties if the 'animation' property was just changed.
+		if (dirty_animation)
+		{
+			HandleAnimationProperty();
+			AdvanceAnimations();
+			UpdateProperties(dp_ratio, vp_dimensions);
+		}
+
+		// Running animations and transitions need to be advanced on every update.
+		if (!animations.empty())
+			DirtyUpdate();
 	}
 
-	for (size_t i = 0; i < children.size(); i++)
-		children[i]->Update(dp_ratio, vp_dimensions);
+	if (dirty_update_descendants)
+	{
+		dirty_update_descendants = false;
+
+		for (size_t i = 0; i < children.size(); i++)
+			children[i]->Update(dp_ratio, vp_dimensions);
+	}
 }
 
 void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimensions)
@@ -192,7 +227,15 @@ void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimension
 		// Computed values are just calculated and can safely be used in OnPropertyChange.
 		// However, new properties set during this call will not be available until the next update loop.
 		if (!dirty_properties.Empty())
+		{
+			// Descendants are no longer rendered when we are removed from the layout, and may overflow our own area.
+			if (dirty_properties.Contains(PropertyId::Display))
+				DirtyDamageRegionRecursive(this);
+			else
+				DirtyDamageRegion();
+
 			OnPropertyChange(dirty_properties);
+		}
 	}
 }
 
@@ -352,6 +395,8 @@ void Element::SetOffset(Vector2f offset, Element* _offset_parent, bool _offset_f
 		offset_parent != _offset_parent ||
 		offset_fixed != _offset_fixed)
 	{
+		DirtyDamageRegion();
+
 		relative_offset_base = offset;
 		offset_fixed = _offset_fixed;
 		offset_parent = _offset_parent;
@@ -428,6 +473,9 @@ void Element::SetContentBox(Vector2f _content_offset, Vector2f _content_box)
 	if (content_offset != _content_offset ||
 		content_box != _content_box)
 	{
+		const Vector2f old_content_offset = content_offset;
+		const Vector2f old_scroll_offset = scroll_offset;
+
 		// Seems to be jittering a wee bit; might need to be looked at.
 		scroll_offset.x += (content_offset.x - _content_offset.x);
 		scroll_offset.y += (content_offset.y - _content_offset.y);
@@ -437,7 +485,10 @@ void Element::SetContentBox(Vector2f _content_offset, Vector2f _content_box)
 
 		scroll_offset.x = Math::Min(scroll_offset.x, GetScrollWidth() - GetClientWidth());
 		scroll_offset.y = Math::Min(scroll_offset.y, GetScrollHeight() - GetClientHeight());
-		DirtyOffset();
+
+		// Our children only move if the content or scroll offset changed, not when only the size of the content changed.
+		if (content_offset != old_content_offset || scroll_offset != old_scroll_offset)
+			DirtyOffset();
 	}
 }
 
@@ -446,6 +497,8 @@ void Element::SetBox(const Box& box)
 {
 	if (box != main_box || additional_boxes.size() > 0)
 	{
+		DirtyDamageRegion();
+
 		main_box = box;
 		additional_boxes.clear();
 
@@ -460,6 +513,8 @@ void Element::SetBox(const Box& box)
 // Adds a box to the end of the list describing this element's geometry.
 void Element::AddBox(const Box& box, Vector2f offset)
 {
+	DirtyDamageRegion();
+
 	additional_boxes.emplace_back(PositionedBox{ box, offset });
 
 	OnResize();
@@ -1409,6 +1464,8 @@ ElementPtr Element::RemoveChild(Element* child)
 			for (int i = 0; i <= ChildNotifyLevels && ancestor; i++, ancestor = ancestor->GetParentNode())
 				ancestor->OnChildRemove(child);
 
+			meta->style.RemoveSharingCandidate(child);
+
 			if (child_index >= children.size() - num_non_dom_children)
 				num_non_dom_children--;
 
@@ -1700,13 +1757,13 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
 	RMLUI_ZoneScoped;
 
-	if (!IsLayoutDirty())
+	// Force a relayout if any of the changed properties require it. Our own box may change, so we can no longer be
+	// formatted as a layout boundary until laid out again.
+	const PropertyIdSet changed_properties_forcing_layout = (changed_properties & StyleSheetSpecification::GetRegisteredPropertiesForcingLayout());
+	if (!changed_properties_forcing_layout.Empty())
 	{
-		// Force a relayout if any of the changed properties require it.
-		const PropertyIdSet changed_properties_forcing_layout = (changed_properties & StyleSheetSpecification::GetRegisteredPropertiesForcingLayout());
-		
-		if(!changed_properties_forcing_layout.Empty())
-			DirtyLayout();
+		layout_boundary = false;
+		DirtyLayout();
 	}
 
 	const bool border_radius_changed = (
@@ -1802,7 +1859,6 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	// Dirty the background if it's changed.
     if (border_radius_changed ||
 		changed_properties.Contains(PropertyId::BackgroundColor) ||
-		changed_properties.Contains(PropertyId::Opacity) ||
 		changed_properties.Contains(PropertyId::ImageColor))
 	{
 		meta->background_border.DirtyBackground();
@@ -1817,16 +1873,23 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		changed_properties.Contains(PropertyId::BorderTopColor) ||
 		changed_properties.Contains(PropertyId::BorderRightColor) ||
 		changed_properties.Contains(PropertyId::BorderBottomColor) ||
-		changed_properties.Contains(PropertyId::BorderLeftColor) ||
-		changed_properties.Contains(PropertyId::Opacity))
+		changed_properties.Contains(PropertyId::BorderLeftColor))
 	{
 		meta->background_border.DirtyBorder();
 	}
 	
+	// Opacity is applied to the geometry of the background, border, text, and decorators when rendering, thus only the
+	// recorded render commands are outdated.
+	if (changed_properties.Contains(PropertyId::Opacity))
+	{
+		if (Context* context = GetContext())
+			context->DirtyRenderCommands();
+		DirtyDamageRegion();
+	}
+
 	// Dirty the decoration if it's changed.
 	if (border_radius_changed ||
 		changed_properties.Contains(PropertyId::Decorator) ||
-		changed_properties.Contains(PropertyId::Opacity) ||
 		changed_properties.Contains(PropertyId::ImageColor))
 	{
 		meta->decoration.DirtyDecorators();
@@ -1858,6 +1921,7 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	if (changed_properties.Contains(PropertyId::Transition))
 	{
 		dirty_transition = true;
+		DirtyUpdate();
 	}
 }
 
@@ -1878,9 +1942,9 @@ void Element::OnChildRemove(Element* /*child*/)
 // Forces a re-layout of this element, and any other children required.
 void Element::DirtyLayout()
 {
-	Element* document = GetOwnerDocument();
+	ElementDocument* document = GetOwnerDocument();
 	if (document != nullptr)
-		document->DirtyLayout();
+		document->DirtyElementLayout(this);
 }
 
 // Forces a re-layout of this element, and any other children required.
@@ -1960,6 +2024,27 @@ const Style::ComputedValues& Element::GetComputedValues() const
 	return meta->computed_values;
 }
 
+void Element::DirtyDamageRegion()
+{
+	if (dirty_damage_region)
+		return;
+
+	if (Context* context = GetContext())
+	{
+		dirty_damage_region = true;
+		context->DirtyDamageRegion(this);
+	}
+}
+
+void Element::DirtyUpdate()
+{
+	dirty_update = true;
+
+	// Let the ancestors know that they have a dirty descendant, we can stop as soon as one of them is already marked.
+	for (Element* ancestor = parent; ancestor && !ancestor->dirty_update_descendants; ancestor = ancestor->parent)
+		ancestor->dirty_update_descendants = true;
+}
+
 void Element::GetRML(String& content)
 {
 	// First we start the open tag, add the attributes then close the open tag.
@@ -2044,6 +2129,9 @@ void Element::SetParent(Element* _parent)
 
 	parent = _parent;
 
+	// Our containing block is no longer known, the flag is set again once we are formatted in our new place.
+	layout_boundary = false;
+
 	if (parent)
 	{
 		// We need to update our definition and make sure we inherit the properties of our new parent.
@@ -2097,9 +2185,16 @@ void Element::DirtyOffset()
 		if(transform_state)
 			DirtyTransformState(true, true);
 
+		// Offsets are resolved during rendering, thus any recorded render commands are now outdated.
+		if (Context* context = GetContext())
+			context->DirtyRenderCommands();
+
 		// Not strictly true ... ?
 		for (size_t i = 0; i < children.size(); i++)
+		{
+			children[i]->DirtyDamageRegion();
 			children[i]->DirtyOffset();
+		}
 	}
 }
 
@@ -2176,6 +2271,7 @@ void Element::BuildLocalStackingContext()
 {
 	stacking_context_dirty = false;
 	stacking_context.clear();
+	hit_test_grid.reset();
 
 	BuildStackingContext(&stacking_context);
 	std::stable_sort(stacking_context.begin(), stacking_context.end(), [](const Element* lhs, const Element* rhs) { return lhs->GetZIndex() < rhs->GetZIndex(); });
@@ -2310,9 +2406,31 @@ void Element::DirtyStackingContext()
 		stacking_context_parent->stacking_context_dirty = true;
 }
 
+void Element::MoveChildBefore(Element* child, Element* adjacent_element)
+{
+	auto find_child = [this](Element* element) {
+		return std::find_if(children.begin(), children.begin() + GetNumChildren(), [element](const ElementPtr& ptr) { return ptr.get() == element; });
+	};
+
+	const auto it_child = find_child(child);
+	const auto it_adjacent = (adjacent_element ? find_child(adjacent_element) : children.begin() + GetNumChildren());
+	if (it_child == children.begin() + GetNumChildren() || it_child == it_adjacent || it_child + 1 == it_adjacent)
+		return;
+
+	if (it_child < it_adjacent)
+		std::rotate(it_child, it_child + 1, it_adjacent);
+	else
+		std::rotate(it_adjacent, it_child, it_child + 1);
+
+	DirtyLayout();
+	DirtyStackingContext();
+	DirtyStructure();
+}
+
 void Element::DirtyStructure()
 {
 	structure_dirty = true;
+	DirtyUpdate();
 }
 
 void Element::UpdateStructure()
@@ -2322,7 +2440,7 @@ void Element::UpdateStructure()
 		structure_dirty = false;
 
 		// If this element or its children depend on structured selectors, they may need to be updated.
-		GetStyle()->DirtyDefinition();
+		GetStyle()->DirtyDependentDefinition();
 	}
 }
 
@@ -2405,6 +2523,10 @@ ElementAnimationList::iterator Element::StartAnimation(PropertyId property_id, c
 		animations.erase(it);
 		it = animations.end();
 	}
+	else
+	{
+		DirtyUpdate();
+	}
 
 	return it;
 }
@@ -2782,6 +2904,9 @@ void Element::UpdateTransformState()
 	{
 		for (size_t i = 0; i < children.size(); i++)
 			children[i]->DirtyTransformState(false, true);
+
+		if (Context* context = GetContext())
+			context->DirtyHitTestGrids();
 	}
 
 	// No reason to keep the transform state around if transform and perspective have been removed.
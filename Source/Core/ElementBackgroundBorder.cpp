@@ -49,7 +49,7 @@ void ElementBackgroundBorder::Render(Element * element)
 	}
 
 	if (geometry)
-		geometry.Render(element->GetAbsoluteOffset(Box::BORDER));
+		geometry.Render(element->GetAbsoluteOffset(Box::BORDER), element->GetComputedValues().opacity);
 }
 
 void ElementBackgroundBorder::DirtyBackground()
@@ -74,16 +74,7 @@ void ElementBackgroundBorder::GenerateGeometry(Element* element)
 		computed.border_left_color,
 	};
 	
-	// Apply opacity
-	const float opacity = computed.opacity;
-	background_color.alpha = (byte)(opacity * (float)background_color.alpha);
-
-	if (opacity < 1)
-	{
-		for (int i = 0; i < 4; ++i)
-			border_colors[i].alpha = (byte)(opacity * (float)border_colors[i].alpha);
-	}
-
+	// Opacity is applied when rendering, so that changing it does not require the geometry to be regenerated.
 	geometry.GetVertices().clear();
 	geometry.GetIndices().clear();
 
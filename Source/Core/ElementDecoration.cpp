@@ -28,6 +28,7 @@
 
 #include "ElementDecoration.h"
 #include "ElementDefinition.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Decorator.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
@@ -71,6 +72,14 @@ int ElementDecoration::LoadDecorator(SharedPtr<const Decorator> decorator)
 {
 	DecoratorHandle element_decorator;
 	element_decorator.decorator_data = decorator->GenerateElementData(element);
+
+	// Decorators may depend on the dimensions of their textures, thus they need to be regenerated once loaded.
+	if (Context* context = element->GetContext())
+	{
+		for (int i = 0; i < decorator->GetNumTextures(); i++)
+			context->AddTextureLoadListener(element, *decorator->GetTexture(i));
+	}
+
 	element_decorator.decorator = std::move(decorator);
 
 	decorators.push_back(element_decorator);
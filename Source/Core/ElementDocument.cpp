@@ -431,7 +431,50 @@ void ElementDocument::UpdateLayout()
 		// Ignore dirtied layout during document formatting. Layouting must not require re-iteration.
 		// In particular, scrollbars being enabled may set the dirty flag, but this case is already handled within the layout engine.
 		layout_dirty = false;
+		dirty_layout_boundaries.clear();
 	}
+	else if (!dirty_layout_boundaries.empty())
+	{
+		RMLUI_ZoneScopedN("UpdateLayoutBoundaries");
+
+		if (!UpdateLayoutBoundaries())
+		{
+			layout_dirty = true;
+			UpdateLayout();
+		}
+	}
+}
+
+bool ElementDocument::UpdateLayoutBoundaries()
+{
+	UnorderedSet<Element*> boundaries;
+	for (const ObserverPtr<Element>& boundary : dirty_layout_boundaries)
+	{
+		if (Element* element = boundary.get())
+			boundaries.insert(element);
+	}
+
+	// As with the whole document, any layout dirtied during formatting is ignored.
+	dirty_layout_boundaries.clear();
+
+	for (Element* boundary : boundaries)
+	{
+		// Skip boundaries which are formatted as part of a dirty ancestor boundary.
+		Element* ancestor = boundary->GetParentNode();
+		while (ancestor && ancestor != this && boundaries.count(ancestor) == 0)
+			ancestor = ancestor->GetParentNode();
+
+		if (ancestor && ancestor != this)
+			continue;
+
+		// The boundary may have been moved out of the document, or changed in a way that affects its own box, since it was dirtied.
+		if (ancestor != this || !boundary->layout_boundary)
+			return false;
+
+		LayoutEngine::FormatElement(boundary, boundary->layout_containing_block);
+	}
+
+	return true;
 }
 
 // Updates the position of the document based on the style properties.
@@ -485,7 +528,27 @@ void ElementDocument::DirtyLayout()
 
 bool ElementDocument::IsLayoutDirty()
 {
-	return layout_dirty;
+	return layout_dirty || !dirty_layout_boundaries.empty();
+}
+
+void ElementDocument::DirtyElementLayout(Element* element)
+{
+	if (layout_dirty)
+		return;
+
+	// The element's own box may change, so start the search from its parent.
+	Element* boundary = element->GetParentNode();
+	while (boundary && boundary != this && !boundary->layout_boundary)
+		boundary = boundary->GetParentNode();
+
+	if (!boundary || boundary == this)
+	{
+		layout_dirty = true;
+		return;
+	}
+
+	if (dirty_layout_boundaries.empty() || dirty_layout_boundaries.back().get() != boundary)
+		dirty_layout_boundaries.push_back(boundary->GetObserverPtr());
 }
 
 void ElementDocument::DirtyDpProperties()
@@ -46,6 +46,7 @@
 #include "ElementDefinition.h"
 #include "ComputeProperty.h"
 #include "PropertiesIterator.h"
+#include "StyleMatchingPass.h"
 #include <algorithm>
 
 
@@ -65,6 +66,8 @@ ElementStyle::ElementStyle(Element* _element)
 {
 	element = _element;
 	definition_dirty = true;
+	definition_shareable = false;
+	sharing_candidate = nullptr;
 }
 
 // Returns one of this element's properties.
@@ -178,10 +181,40 @@ void ElementStyle::UpdateDefinition()
 		definition_dirty = false;
 
 		SharedPtr<ElementDefinition> new_definition;
-		
+
+		// Our ancestors may have changed, thus our children can no longer share definitions with previously fetched ones.
+		sharing_candidate = nullptr;
+		definition_shareable = false;
+
 		if (const StyleSheet* style_sheet = element->GetStyleSheet())
 		{
-			new_definition = style_sheet->GetElementDefinition(element);
+			// Siblings with equal tag, id, classes and pseudo classes match the exact same style sheet nodes, as long as
+			// none of these nodes contain structural selectors. Reuse the definition of such a sibling when available.
+			Element* parent = element->GetParentNode();
+			ElementStyle* parent_style = (parent ? parent->GetStyle() : nullptr);
+			Element* candidate = (parent_style ? parent_style->sharing_candidate : nullptr);
+
+			if (StyleMatchingPass::GetMatchedDefinition(element, new_definition))
+			{
+				definition_shareable = true;
+
+				if (parent_style)
+					parent_style->sharing_candidate = element;
+			}
+			else if (candidate && candidate != element && CanShareDefinitionWith(candidate))
+			{
+				new_definition = candidate->GetStyle()->definition;
+				definition_shareable = true;
+			}
+			else
+			{
+				bool structurally_volatile = false;
+				new_definition = style_sheet->GetElementDefinition(element, &structurally_volatile);
+				definition_shareable = !structurally_volatile;
+
+				if (parent_style && definition_shareable)
+					parent_style->sharing_candidate = element;
+			}
 		}
 		
 		// Switch the property definitions if the definition has changed.
@@ -223,6 +256,34 @@ void ElementStyle::UpdateDefinition()
 	}
 }
 
+void ElementStyle::RemoveSharingCandidate(const Element* child)
+{
+	if (sharing_candidate == child)
+		sharing_candidate = nullptr;
+}
+
+bool ElementStyle::CanShareDefinitionWith(const Element* sibling) const
+{
+	const ElementStyle* sibling_style = sibling->GetStyle();
+
+	if (!sibling_style->definition_shareable || sibling_style->definition_dirty)
+		return false;
+
+	if (element->GetTagName() != sibling->GetTagName() || element->GetId() != sibling->GetId())
+		return false;
+
+	if (classes != sibling_style->classes || pseudo_classes.size() != sibling_style->pseudo_classes.size())
+		return false;
+
+	for (const auto& pseudo_class : pseudo_classes)
+	{
+		if (sibling_style->pseudo_classes.find(pseudo_class.first) == sibling_style->pseudo_classes.end())
+			return false;
+	}
+
+	return element->GetStyleSheet() == sibling->GetStyleSheet();
+}
+
 // Sets or removes a pseudo-class on the element.
 bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, bool override_class)
 {
@@ -319,6 +380,11 @@ String ElementStyle::GetClassNames() const
 	return class_names;
 }
 
+const StringList& ElementStyle::GetClassNameList() const
+{
+	return classes;
+}
+
 // Sets a local property override on the element to a pre-parsed value.
 bool ElementStyle::SetProperty(PropertyId id, const Property& property)
 {
@@ -461,19 +527,27 @@ float ElementStyle::ResolveLength(const Property* property, RelativeTarget relat
 }
 
 void ElementStyle::DirtyDefinition()
+{
+	// The selector inputs have changed, any definitions matched ahead of the update can no longer be trusted.
+	StyleMatchingPass::Invalidate();
+	DirtyDependentDefinition();
+}
+
+void ElementStyle::DirtyDependentDefinition()
 {
 	definition_dirty = true;
+	element->DirtyUpdate();
 }
 
 void ElementStyle::DirtyInheritedProperties()
 {
-	dirty_properties |= StyleSheetSpecification::GetRegisteredInheritedProperties();
+	DirtyProperties(StyleSheetSpecification::GetRegisteredInheritedProperties());
 }
 
 void ElementStyle::DirtyChildDefinitions()
 {
 	for (int i = 0; i < element->GetNumChildren(true); i++)
-		element->GetChild(i)->GetStyle()->DirtyDefinition();
+		element->GetChild(i)->GetStyle()->DirtyDependentDefinition();
 }
 
 void ElementStyle::DirtyPropertiesWithUnitsRecursive(Property::Unit units)
@@ -526,12 +600,17 @@ PropertiesIterator ElementStyle::Iterate() const {
 void ElementStyle::DirtyProperty(PropertyId id)
 {
 	dirty_properties.Insert(id);
+	element->DirtyUpdate();
 }
 
 // Sets a list of properties as dirty.
 void ElementStyle::DirtyProperties(const PropertyIdSet& properties)
 {
+	if (properties.Empty())
+		return;
+
 	dirty_properties |= properties;
+	element->DirtyUpdate();
 }
 
 PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const Style::ComputedValues* parent_values, const Style::ComputedValues* document_values, bool values_are_default_initialized, float dp_ratio, Vector2f vp_dimensions)
@@ -541,6 +620,35 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 
 	RMLUI_ZoneScopedC(0xFF7F50);
 
+	// Opacity and transform are commonly animated every frame, and neither depends on any other property. When they are
+	// the only dirty properties, compute them directly instead of resetting and iterating over all local properties.
+	const size_t num_dirty_opacity_transform = size_t(dirty_properties.Contains(PropertyId::Opacity)) + size_t(dirty_properties.Contains(PropertyId::Transform));
+	if (!values_are_default_initialized && dirty_properties.Size() == num_dirty_opacity_transform)
+	{
+		if (dirty_properties.Contains(PropertyId::Opacity))
+		{
+			if (auto p = GetLocalProperty(PropertyId::Opacity))
+				values.opacity = p->Get<float>();
+			else
+				values.opacity = (parent_values ? parent_values->opacity : DefaultComputedValues.opacity);
+
+			for (int i = 0; i < element->GetNumChildren(true); i++)
+				element->GetChild(i)->GetStyle()->DirtyProperty(PropertyId::Opacity);
+		}
+
+		if (dirty_properties.Contains(PropertyId::Transform))
+		{
+			if (auto p = GetLocalProperty(PropertyId::Transform))
+				values.transform = p->Get<TransformPtr>();
+			else
+				values.transform = DefaultComputedValues.transform;
+		}
+
+		PropertyIdSet result(std::move(dirty_properties));
+		dirty_properties.Clear();
+		return result;
+	}
+
 	// Generally, this is how it works:
 	//   1. Assign default values (clears any removed properties)
 	//   2. Inherit inheritable values from parent
@@ -970,7 +1078,7 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 		for (int i = 0; i < element->GetNumChildren(true); i++)
 		{
 			auto child = element->GetChild(i);
-			child->GetStyle()->dirty_properties |= dirty_inherited_properties;
+			child->GetStyle()->DirtyProperties(dirty_inherited_properties);
 		}
 	}
 	
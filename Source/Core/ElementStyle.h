@@ -38,6 +38,7 @@ namespace Rml {
 
 class ElementDefinition;
 class PropertiesIterator;
+class StyleMatchingPass;
 enum class RelativeTarget;
 
 enum class PseudoClassState : std::uint8_t { Clear = 0, Set = 1, Override = 2 };
@@ -58,6 +59,9 @@ public:
 
 	/// Update this definition if required
 	void UpdateDefinition();
+	/// Forgets the child used as the style-sharing candidate for its siblings, if it is the given element.
+	/// @param[in] child The child being removed from this element.
+	void RemoveSharingCandidate(const Element* child);
 
 	/// Sets or removes a pseudo-class on the element.
 	/// @param[in] pseudo_class The pseudo class to activate or deactivate.
@@ -87,6 +91,9 @@ public:
 	/// Return the active class list.
 	/// @return A string containing all the classes on the element, separated by spaces.
 	String GetClassNames() const;
+	/// Return the active class list.
+	/// @return The list of classes on the element.
+	const StringList& GetClassNameList() const;
 
 	/// Sets a local property override on the element to a pre-parsed value.
 	/// @param[in] name The name of the new property.
@@ -120,6 +127,8 @@ public:
 
 	/// Mark definition and all children dirty.
 	void DirtyDefinition();
+	/// Mark definition and all children dirty, due to a change that has already been signaled by a call to DirtyDefinition() on this element or an ancestor.
+	void DirtyDependentDefinition();
 
 	/// Mark inherited properties dirty.
 	/// Inherited properties will automatically be set when parent inherited properties are changed. However,
@@ -150,6 +159,9 @@ private:
 
 	static const Property* GetLocalProperty(PropertyId id, const PropertyDictionary & inline_properties, const ElementDefinition * definition);
 	static const Property* GetProperty(PropertyId id, const Element * element, const PropertyDictionary & inline_properties, const ElementDefinition * definition);
+	// Returns true if this element is guaranteed to match the same style sheet nodes as the given sibling.
+	bool CanShareDefinitionWith(const Element* sibling) const;
+
 	static void TransitionPropertyChanges(Element * element, PropertyIdSet & properties, const PropertyDictionary & inline_properties, const ElementDefinition * old_definition, const ElementDefinition * new_definition);
 
 	// Element these properties belong to
@@ -166,8 +178,15 @@ private:
 	SharedPtr<ElementDefinition> definition;
 	// Set if a new element definition should be fetched from the style.
 	bool definition_dirty;
+	// Set if the definition does not depend on any structural selectors, and thus can be shared with matching siblings.
+	bool definition_shareable;
+
+	// The last child whose shareable definition was fetched from the style sheet, matching siblings may reuse its definition.
+	Element* sharing_candidate;
 
 	PropertyIdSet dirty_properties;
+
+	friend class Rml::StyleMatchingPass;
 };
 
 } // namespace Rml
@@ -29,6 +29,7 @@
 #include "../../Include/RmlUi/Core/ElementText.h"
 #include "ElementDefinition.h"
 #include "ElementStyle.h"
+#include "StringWidthCache.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/ElementDocument.h"
@@ -68,6 +69,9 @@ void ElementText::SetText(const String& _text)
 	{
 		text = _text;
 
+		// The text may change without affecting our size, make sure the new text is displayed.
+		DirtyDamageRegion();
+
 		if (dirty_layout_on_change)
 			DirtyLayout();
 	}
@@ -88,14 +92,15 @@ void ElementText::OnRender()
 	
 	// If our font effects have potentially changed, update it and force a geometry generation if necessary.
 	if (font_effects_dirty && UpdateFontEffects())
-		geometry_dirty = true;
+		DirtyGeometry();
 
 	// Dirty geometry if font version has changed.
 	int new_version = GetFontEngineInterface()->GetVersion(font_face_handle);
 	if (new_version != font_handle_version)
 	{
 		font_handle_version = new_version;
-		geometry_dirty = true;
+		DirtyGeometry();
+		DirtyDamageRegion();
 	}
 
 	// Regenerate the geometry if the colour or font configuration has altered.
@@ -147,14 +152,16 @@ void ElementText::OnRender()
 		}
 	}
 	
+	const float opacity = GetComputedValues().opacity;
+
 	if (render)
 	{
 		for (size_t i = 0; i < geometry.size(); ++i)
-			geometry[i].Render(translation);
+			geometry[i].Render(translation, opacity);
 	}
 
 	if (decoration_property != Style::TextDecoration::None)
-		decoration.Render(translation);
+		decoration.Render(translation, opacity);
 }
 
 // Generates a token of text from this element, returning only the width.
@@ -183,7 +190,7 @@ bool ElementText::GenerateToken(float& token_width, int line_begin)
 	String token;
 
 	BuildToken(token, token_begin, text.c_str() + text.size(), true, collapse_white_space, break_at_endline, computed.text_transform, true);
-	token_width = (float) GetFontEngineInterface()->GetStringWidth(font_face_handle, token);
+	token_width = (float) StringWidthCache::GetStringWidth(font_face_handle, token);
 
 	return LastToken(token_begin, text.c_str() + text.size(), collapse_white_space, break_at_endline);
 }
@@ -239,7 +246,7 @@ bool ElementText::GenerateLine(String& line, int& line_length, float& line_width
 
 		// Generate the next token and determine its pixel-length.
 		bool break_line = BuildToken(token, next_token_begin, string_end, line.empty() && trim_whitespace_prefix, collapse_white_space, break_at_endline, text_transform_property, decode_escape_characters);
-		int token_width = font_engine_interface->GetStringWidth(font_face_handle, token, previous_codepoint);
+		int token_width = StringWidthCache::GetStringWidth(font_face_handle, token, previous_codepoint);
 
 		// If we're breaking to fit a line box, check if the token can fit on the line before we add it.
 		if (break_at_line)
@@ -310,13 +317,12 @@ bool ElementText::GenerateLine(String& line, int& line_length, float& line_width
 // Clears all lines of generated text and prepares the element for generating new lines.
 void ElementText::ClearLines()
 {
-	// Clear the rendering information.
-	for (size_t i = 0; i < geometry.size(); ++i)
-		geometry[i].Release(true);
+	// Keep the lines our current geometry was generated from, if the new lines turn out identical we can reuse it.
+	if (!geometry_dirty)
+		generated_lines.swap(lines);
 
 	lines.clear();
-	generated_decoration = Style::TextDecoration::None;
-	decoration.Release(true);
+	geometry_dirty = true;
 }
 
 // Adds a new line into the text element.
@@ -327,13 +333,11 @@ void ElementText::AddLine(Vector2f line_position, const String& line)
 	if (font_face_handle == 0)
 		return;
 
-	if (font_effects_dirty)
-		UpdateFontEffects();
+	if (font_effects_dirty && UpdateFontEffects())
+		DirtyGeometry();
 
 	Vector2f baseline_position = line_position + Vector2f(0.0f, (float)GetFontEngineInterface()->GetLineHeight(font_face_handle) - GetFontEngineInterface()->GetBaseline(font_face_handle));
 	lines.emplace_back(line, baseline_position);
-
-	geometry_dirty = true;
 }
 
 // Prevents the element from dirtying its document's layout when its text is changed.
@@ -352,13 +356,10 @@ void ElementText::OnPropertyChange(const PropertyIdSet& changed_properties)
 	bool font_face_changed = false;
 	auto& computed = GetComputedValues();
 
-	if (changed_properties.Contains(PropertyId::Color) ||
-		changed_properties.Contains(PropertyId::Opacity))
+	if (changed_properties.Contains(PropertyId::Color))
 	{
-		// Fetch our (potentially) new colour.
-		Colourb new_colour = computed.color;
-		float opacity = computed.opacity;
-		new_colour.alpha = byte(opacity * float(new_colour.alpha));
+		// Fetch our (potentially) new colour. Opacity is applied when rendering.
+		const Colourb new_colour = computed.color;
 		colour_changed = colour != new_colour;
 		if (colour_changed)
 			colour = new_colour;
@@ -372,6 +373,7 @@ void ElementText::OnPropertyChange(const PropertyIdSet& changed_properties)
 		font_face_changed = true;
 
 		geometry.clear();
+		generated_lines.clear();
 		font_effects_dirty = true;
 	}
 
@@ -394,7 +396,7 @@ void ElementText::OnPropertyChange(const PropertyIdSet& changed_properties)
 	else if (colour_changed)
 	{
 		// Force the geometry to be regenerated.
-		geometry_dirty = true;
+		DirtyGeometry();
 
 		// Re-colour the decoration geometry.
 		Vector< Vertex >& vertices = decoration.GetVertices();
@@ -445,6 +447,20 @@ void ElementText::GenerateGeometry(const FontFaceHandle font_face_handle)
 {
 	RMLUI_ZoneScopedC(0xD2691E);
 
+	// If layout only reproduced the lines we last generated, the existing geometry is still valid.
+	if (!generated_lines.empty() && generated_lines.size() == lines.size() &&
+		std::equal(lines.begin(), lines.end(), generated_lines.begin(), [](const Line& a, const Line& b) { return a.text == b.text && a.position == b.position; }))
+	{
+		for (size_t i = 0; i < lines.size(); ++i)
+			lines[i].width = generated_lines[i].width;
+
+		generated_lines.clear();
+		geometry_dirty = false;
+		return;
+	}
+
+	generated_lines.clear();
+
 	// Release the old geometry ...
 	for (size_t i = 0; i < geometry.size(); ++i)
 		geometry[i].Release(true);
@@ -459,6 +475,12 @@ void ElementText::GenerateGeometry(const FontFaceHandle font_face_handle)
 	geometry_dirty = false;
 }
 
+void ElementText::DirtyGeometry()
+{
+	geometry_dirty = true;
+	generated_lines.clear();
+}
+
 void ElementText::GenerateGeometry(const FontFaceHandle font_face_handle, Line& line)
 {
 	line.width = GetFontEngineInterface()->GenerateString(font_face_handle, font_effects_handle, line.text, line.position, colour, geometry);
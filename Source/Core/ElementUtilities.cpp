@@ -40,6 +40,7 @@
 #include "ElementStyle.h"
 #include "LayoutDetails.h"
 #include "LayoutEngine.h"
+#include "RenderCommandRecorder.h"
 #include "TransformState.h"
 #include <limits>
 
@@ -295,6 +296,12 @@ void ElementUtilities::ApplyActiveClipRegion(Context* context, RenderInterface*
 	Vector2i dimensions;
 	bool clip_enabled = context->GetActiveClipRegion(origin, dimensions);
 
+	if (RenderCommandRecorder* recorder = context->GetActiveRenderCommandRecorder())
+	{
+		recorder->SetScissorRegion(clip_enabled, origin, dimensions);
+		return;
+	}
+
 	render_interface->EnableScissorRegion(clip_enabled);
 	if (clip_enabled)
 	{
@@ -363,6 +370,21 @@ bool ElementUtilities::ApplyTransform(Element &element)
 	if (const TransformState* state = element.GetTransformState())
 		new_transform = state->GetTransform();
 
+	// While recording, the transform is added to the command list. The command list is always submitted starting and
+	// ending without any transform, so make sure the render interface is left in the same state.
+	Context* context = element.GetContext();
+	if (RenderCommandRecorder* recorder = (context ? context->GetActiveRenderCommandRecorder() : nullptr))
+	{
+		if (old_transform)
+		{
+			render_interface->SetTransform(nullptr);
+			old_transform = nullptr;
+		}
+
+		recorder->SetTransform(new_transform);
+		return true;
+	}
+
 	// Only changed transforms are submitted.
 	if (old_transform != new_transform)
 	{
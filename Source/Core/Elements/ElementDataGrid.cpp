@@ -235,6 +235,9 @@ void ElementDataGrid::OnUpdate()
 	{
 		DispatchEvent(EventId::Rowupdate, Dictionary());
 	}
+
+	// The data source is polled for new rows on every update.
+	DirtyUpdate();
 }
 
 
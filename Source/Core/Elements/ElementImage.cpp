@@ -31,6 +31,7 @@
 #include "../../../Include/RmlUi/Core/URL.h"
 #include "../../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../../Include/RmlUi/Core/GeometryUtilities.h"
+#include "../../../Include/RmlUi/Core/Context.h"
 #include "../../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../../Include/RmlUi/Core/StyleSheet.h"
 
@@ -54,6 +55,10 @@ bool ElementImage::GetIntrinsicDimensions(Vector2f& _dimensions, float& _ratio)
 	if (texture_dirty)
 		LoadTexture();
 
+	// Our dimensions may depend on the texture, thus we need to be laid out again if it is loaded asynchronously.
+	if (Context* context = GetContext())
+		context->AddTextureLoadListener(this, texture);
+
 	// Calculate the x dimension.
 	if (HasAttribute("width"))
 		dimensions.x = GetAttribute< float >("width", -1);
@@ -86,7 +91,7 @@ void ElementImage::OnRender()
 		GenerateGeometry();
 
 	// Render the geometry beginning at this element's content region.
-	geometry.Render(GetAbsoluteOffset(Box::CONTENT).Round());
+	geometry.Render(GetAbsoluteOffset(Box::CONTENT).Round(), GetComputedValues().opacity);
 }
 
 // Called when attributes on the element are changed.
@@ -132,8 +137,7 @@ void ElementImage::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
     Element::OnPropertyChange(changed_properties);
 
-    if (changed_properties.Contains(PropertyId::ImageColor) ||
-        changed_properties.Contains(PropertyId::Opacity)) {
+    if (changed_properties.Contains(PropertyId::ImageColor)) {
         GenerateGeometry();
     }
 }
@@ -188,15 +192,15 @@ void ElementImage::GenerateGeometry()
 
 	const ComputedValues& computed = GetComputedValues();
 
-	float opacity = computed.opacity;
-	Colourb quad_colour = computed.image_color;
-    quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
+	// Opacity is applied when rendering.
+	const Colourb quad_colour = computed.image_color;
 	
 	Vector2f quad_size = GetBox().GetSize(Box::CONTENT).Round();
 
 	GeometryUtilities::GenerateQuad(&vertices[0], &indices[0], Vector2f(0, 0), quad_size, quad_colour, texcoords[0], texcoords[1]);
 
-	geometry_dirty = false;
+	// The texture coordinates depend on the texture dimensions, regenerate them once the texture has been loaded.
+	geometry_dirty = (rect_source != RectSource::None && texture.IsLoading(GetRenderInterface()));
 }
 
 bool ElementImage::LoadTexture()
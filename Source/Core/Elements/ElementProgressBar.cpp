@@ -65,12 +65,12 @@ void ElementProgressBar::SetValue(float in_value)
 
 void ElementProgressBar::OnRender()
 {
-	// Some properties may change geometry without dirtying the layout, eg. opacity.
+	// Some properties may change geometry without dirtying the layout, eg. image-color.
 	if (geometry_dirty)
 		GenerateGeometry();
 
 	// Render the geometry at the fill element's content region.
-	geometry.Render(fill->GetAbsoluteOffset().Round());
+	geometry.Render(fill->GetAbsoluteOffset().Round(), GetComputedValues().opacity);
 }
 
 void ElementProgressBar::OnAttributeChange(const ElementAttributes& changed_attributes)
@@ -122,8 +122,7 @@ void ElementProgressBar::OnPropertyChange(const PropertyIdSet& changed_propertie
 {
     Element::OnPropertyChange(changed_properties);
 
-    if (changed_properties.Contains(PropertyId::ImageColor) ||
-        changed_properties.Contains(PropertyId::Opacity)) {
+    if (changed_properties.Contains(PropertyId::ImageColor)) {
 		geometry_dirty = true;
     }
 
@@ -233,13 +232,8 @@ void ElementProgressBar::GenerateGeometry()
 		texcoords[1] = Vector2f(1, 1);
 	}
 
-	Colourb quad_colour;
-	{
-		const ComputedValues& computed = GetComputedValues();
-		const float opacity = computed.opacity;
-		quad_colour = computed.image_color;
-		quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
-	}
+	// Opacity is applied when rendering.
+	const Colourb quad_colour = GetComputedValues().image_color;
 
 
 	switch (direction) 
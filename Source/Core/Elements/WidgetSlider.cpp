@@ -160,6 +160,9 @@ void WidgetSlider::Update()
 			}
 		}
 	}
+
+	if (arrow_timers[0] > 0 || arrow_timers[1] > 0)
+		parent->DirtyUpdate();
 }
 
 // Sets the position of the bar.
@@ -400,6 +403,9 @@ void WidgetSlider::ProcessEvent(Event& event)
 			last_update_time = Clock::GetElapsedTime();
 			SetBarPosition(OnLineIncrement());
 		}
+
+		if (arrow_timers[0] > 0 || arrow_timers[1] > 0)
+			parent->DirtyUpdate();
 	}
 	break;
 
@@ -228,7 +228,11 @@ void WidgetTextInput::OnUpdate()
 		{
 			cursor_timer += CURSOR_BLINK_TIME;
 			cursor_visible = !cursor_visible;
+			parent->DirtyDamageRegion();
 		}
+
+		// Keep updating for as long as the cursor is blinking.
+		parent->DirtyUpdate();
 	}
 }
 
@@ -888,6 +892,8 @@ void WidgetTextInput::ShowCursor(bool show, bool move_to_cursor)
 		
 		cursor_timer = CURSOR_BLINK_TIME;
 		last_update_time = GetSystemInterface()->GetElapsedTime();
+		parent->DirtyUpdate();
+		parent->DirtyDamageRegion();
 
 		// Shift the cursor into view.
 		if (move_to_cursor)
@@ -913,6 +919,7 @@ void WidgetTextInput::ShowCursor(bool show, bool move_to_cursor)
 		cursor_visible = false;
 		cursor_timer = -1;
 		last_update_time = 0;
+		parent->DirtyDamageRegion();
 		if (keyboard_showed)
 		{
 			SetKeyboardActive(false);
@@ -974,6 +981,9 @@ void WidgetTextInput::FormatElement()
 // Formats the input element's text field.
 Vector2f WidgetTextInput::FormatText()
 {
+	// The text and selection geometry is regenerated below.
+	parent->DirtyDamageRegion();
+
 	absolute_cursor_index = edit_index;
 
 	Vector2f content_area(0, 0);
@@ -1134,6 +1144,7 @@ void WidgetTextInput::GenerateCursor()
 {
 	// Generates the cursor.
 	cursor_geometry.Release();
+	parent->DirtyDamageRegion();
 
 	Vector< Vertex >& vertices = cursor_geometry.GetVertices();
 	vertices.resize(4);
@@ -1160,6 +1171,8 @@ void WidgetTextInput::UpdateCursorPosition()
 	if (text_element->GetFontFaceHandle() == 0)
 		return;
 
+	parent->DirtyDamageRegion();
+
 	cursor_position.x = (float) ElementUtilities::GetStringWidth(text_element, lines[cursor_line_index].content.substr(0, cursor_character_index));
 	cursor_position.y = -1.f + (float)cursor_line_index * text_element->GetLineHeight();
 }
@@ -129,10 +129,48 @@ struct CollectedListener {
 
 	// Default actions are returned by EventPhase::None.
 	EventPhase GetPhase() const { return sort < 0 ? EventPhase::Capture : (sort == 0 ? EventPhase::Target : EventPhase::Bubble); }
+};
+
+/*
+	DispatchBuffers
+
+	Scratch buffers used while dispatching an event, kept between dispatches to avoid reallocating them. Listeners may
+	dispatch new events, thus each active dispatch takes its own set of buffers from the free list.
+*/
+struct DispatchBuffers {
+	Vector<Element*> elements;
+	Vector<CollectedListener> listeners;
+	Vector<ObserverPtr<Element>> default_action_elements;
+};
+
+static Vector<UniquePtr<DispatchBuffers>> free_dispatch_buffers;
 
-	bool operator<(const CollectedListener& other) const {
-		return sort < other.sort;
+class ScopedDispatchBuffers : NonCopyMoveable {
+public:
+	ScopedDispatchBuffers()
+	{
+		if (free_dispatch_buffers.empty())
+		{
+			buffers = MakeUnique<DispatchBuffers>();
+		}
+		else
+		{
+			buffers = std::move(free_dispatch_buffers.back());
+			free_dispatch_buffers.pop_back();
+		}
 	}
+	~ScopedDispatchBuffers()
+	{
+		buffers->elements.clear();
+		buffers->listeners.clear();
+		buffers->default_action_elements.clear();
+		free_dispatch_buffers.push_back(std::move(buffers));
+	}
+
+	DispatchBuffers* operator->() { return buffers.get(); }
+
+private:
+	UniquePtr<DispatchBuffers> buffers;
 };
 
 
@@ -140,39 +178,45 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 {
 	RMLUI_ASSERTMSG(!((int)default_action_phase & (int)EventPhase::Capture), "We assume here that the default action phases cannot include capture phase.");
 
-	Vector<CollectedListener> listeners;
-	Vector<ObserverPtr<Element>> default_action_elements;
+	ScopedDispatchBuffers buffers;
+	Vector<Element*>& elements = buffers->elements;
+	Vector<CollectedListener>& listeners = buffers->listeners;
+	Vector<ObserverPtr<Element>>& default_action_elements = buffers->default_action_elements;
 
-	const EventPhase phases_to_execute = EventPhase((int)EventPhase::Capture | (int)EventPhase::Target | (bubbles ? (int)EventPhase::Bubble : 0));
-	
-	// Walk the DOM tree from target to root, collecting all possible listeners and elements with default actions in the process.
-	int dom_distance_from_target = 0;
-	Element* walk_element = target_element;
-	while (walk_element)
+	// Walk the DOM tree from target to root, collecting all elements with default actions in the process.
+	for (Element* walk_element = target_element; walk_element; walk_element = walk_element->GetParentNode())
 	{
-		EventDispatcher* dispatcher = walk_element->GetEventDispatcher();
-		dispatcher->CollectListeners(dom_distance_from_target, id, phases_to_execute, listeners);
-
-		if(dom_distance_from_target == 0)
+		if (elements.empty())
 		{
 			if ((int)default_action_phase & (int)EventPhase::Target)
 				default_action_elements.push_back(walk_element->GetObserverPtr());
 		}
-		else if((int)default_action_phase & (int)EventPhase::Bubble)
+		else if ((int)default_action_phase & (int)EventPhase::Bubble)
 		{
 			default_action_elements.push_back(walk_element->GetObserverPtr());
 		}
 
-		walk_element = walk_element->GetParentNode();
-		dom_distance_from_target += 1;
+		elements.push_back(walk_element);
+	}
+
+	// Collect all possible listeners in the order they execute: The capture phase from the root down, then the target
+	// phase, and finally the bubble phase from the target up. The order of the listeners on each element is maintained.
+	const int num_elements = (int)elements.size();
+	for (int i = num_elements - 1; i > 0; i--)
+		elements[i]->GetEventDispatcher()->CollectListeners(i, id, EventPhase::Capture, listeners);
+
+	if (num_elements > 0)
+		elements[0]->GetEventDispatcher()->CollectListeners(0, id, EventPhase::Target, listeners);
+
+	if (bubbles)
+	{
+		for (int i = 1; i < num_elements; i++)
+			elements[i]->GetEventDispatcher()->CollectListeners(i, id, EventPhase::Bubble, listeners);
 	}
 
 	if (listeners.empty() && default_action_elements.empty())
 		return true;
 
-	// Use stable_sort so that the order of the listeners in a given element is maintained.
-	std::stable_sort(listeners.begin(), listeners.end());
-
 	// Instance event
 	EventPtr event = Factory::InstanceEvent(target_element, id, type, parameters, interruptible);
 	if (!event)
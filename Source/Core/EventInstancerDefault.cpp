@@ -31,23 +31,39 @@
 
 namespace Rml {
 
+// The number of released events kept for reuse, only exceeded by deeply nested event dispatches.
+static constexpr size_t max_free_events = 16;
+
 EventInstancerDefault::EventInstancerDefault()
 {
 }
 
 EventInstancerDefault::~EventInstancerDefault()
 {
+	for (Event* event : free_events)
+		delete event;
 }
 
 EventPtr EventInstancerDefault::InstanceEvent(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible)
 {
+	if (!free_events.empty())
+	{
+		Event* event = free_events.back();
+		free_events.pop_back();
+		event->Reset(target, id, type, parameters, interruptible);
+		return EventPtr(event);
+	}
+
 	return EventPtr(new Event(target, id, type, parameters, interruptible));
 }
 
 // Releases an event instanced by this instancer.
 void EventInstancerDefault::ReleaseEvent(Event* event)
 {
-	delete event;
+	if (free_events.size() < max_free_events)
+		free_events.push_back(event);
+	else
+		delete event;
 }
 
 void EventInstancerDefault::Release()
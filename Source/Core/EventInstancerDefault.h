@@ -37,6 +37,8 @@ namespace Rml {
 /**
 	Default instancer for instancing events.
 
+	Released events are kept for reuse, so that dispatching an event does not need to allocate the event or its parameters.
+
 	@author Lloyd Weehuizen
  */
 
@@ -59,6 +61,10 @@ public:
 
 	/// Releases this event instancer.
 	void Release() override;
+
+private:
+	// Released events ready to be reused. Events can be dispatched recursively, so more than one may be in use at a time.
+	Vector<Event*> free_events;
 };
 
 } // namespace Rml
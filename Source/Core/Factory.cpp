@@ -184,6 +184,7 @@ struct DefaultInstancers {
 	DataViewInstancerDefault<DataViewChecked> data_view_checked;
 
 	DataViewInstancerDefault<DataViewFor> structural_data_view_for;
+	DataViewInstancerDefault<DataViewVirtualFor> structural_data_view_virtual_for;
 
 	// Data binding controllers
 	DataControllerInstancerDefault<DataControllerValue> data_controller_value;
@@ -276,6 +277,7 @@ bool Factory::Initialise()
 	RegisterDataViewInstancer(&default_instancers->data_view_value,          "value",   false);
 	RegisterDataViewInstancer(&default_instancers->data_view_checked,        "checked", false);
 	RegisterDataViewInstancer(&default_instancers->structural_data_view_for, "for",     true );
+	RegisterDataViewInstancer(&default_instancers->structural_data_view_virtual_for, "virtualfor", true);
 
 	// Data binding controllers
 	RegisterDataControllerInstancer(&default_instancers->data_controller_value, "value");
@@ -226,6 +226,13 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 	RMLUI_ASSERT(layer_configuration_index >= 0);
 	RMLUI_ASSERT(layer_configuration_index < (int) layer_configurations.size());
 
+	// Make sure every glyph of the string is available in the layers before generating its geometry.
+	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
+	{
+		Character character = *it_string;
+		GetOrAppendGlyph(character);
+	}
+
 	UpdateLayersOnDirty();
 
 	// Fetch the requested configuration and generate the geometry for each one.
@@ -295,18 +302,38 @@ bool FontFaceHandleDefault::UpdateLayersOnDirty()
 {
 	bool result = false;
 
-	// If we are dirty, regenerate all the layers and increment the version
 	if(is_layers_dirty && base_layer)
 	{
 		is_layers_dirty = false;
-		++version;
 
-		// Regenerate all the layers.
-		// Note: The layer regeneration needs to happen in the order in which the layers were created,
-		// otherwise we may end up cloning a layer which has not yet been regenerated. This means trouble!
+		// First try to add the new glyphs to the existing layers. This keeps the texture coordinates of the existing glyphs,
+		// so that any string geometry generated previously remains valid.
+		// Note: The layers need to be updated in the order in which they were created, otherwise we may end up cloning a
+		// layer which has not yet been updated. This means trouble!
+		bool glyphs_appended = true;
 		for (auto& pair : layers)
 		{
-			GenerateLayer(pair.layer.get());
+			bool clone_glyph_origins = false;
+			FontFaceLayer* clone = GetCloneLayer(pair.layer.get(), clone_glyph_origins);
+
+			if (!pair.layer->AppendGlyphs(this, appended_glyphs, clone, clone_glyph_origins))
+			{
+				glyphs_appended = false;
+				break;
+			}
+		}
+
+		appended_glyphs.clear();
+
+		// Otherwise, regenerate all the layers and increment the version.
+		if (!glyphs_appended)
+		{
+			++version;
+
+			for (auto& pair : layers)
+			{
+				GenerateLayer(pair.layer.get());
+			}
 		}
 
 		result = true;
@@ -397,6 +424,7 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 			}
 
 			is_layers_dirty = true;
+			appended_glyphs.push_back(character);
 		}
 		else if (look_in_fallback_fonts)
 		{
@@ -413,8 +441,11 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 					// Insert the new glyph into our own set of glyphs
 					auto pair = glyphs.emplace(character, glyph->WeakCopy());
 					it_glyph = pair.first;
-					if(pair.second)
+					if (pair.second)
+					{
 						is_layers_dirty = true;
+						appended_glyphs.push_back(character);
+					}
 					break;
 				}
 			}
@@ -471,32 +502,39 @@ bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
 	else
 	{
 		// Determine which, if any, layer the new layer should copy its geometry and textures from.
-		FontFaceLayer* clone = nullptr;
-		bool clone_glyph_origins = true;
-		String generation_key;
-		size_t fingerprint = font_effect->GetFingerprint();
-
-		if (!font_effect->HasUniqueTexture())
-		{
-			clone = base_layer;
-			clone_glyph_origins = false;
-		}
-		else
-		{
-			auto cache_iterator = layer_cache.find(fingerprint);
-			if (cache_iterator != layer_cache.end() && cache_iterator->second != layer)
-				clone = cache_iterator->second;
-		}
+		bool clone_glyph_origins = false;
+		FontFaceLayer* clone = GetCloneLayer(layer, clone_glyph_origins);
 
 		// Create a new layer.
 		result = layer->Generate(this, clone, clone_glyph_origins);
 
 		// Cache the layer in the layer cache if it generated its own textures (ie, didn't clone).
 		if (!clone)
-			layer_cache[fingerprint] = layer;
+			layer_cache[font_effect->GetFingerprint()] = layer;
 	}
 
 	return result;
 }
 
+FontFaceLayer* FontFaceHandleDefault::GetCloneLayer(const FontFaceLayer* layer, bool& clone_glyph_origins) const
+{
+	const FontEffect* font_effect = layer->GetFontEffect();
+	if (!font_effect)
+		return nullptr;
+
+	if (!font_effect->HasUniqueTexture())
+	{
+		clone_glyph_origins = false;
+		return base_layer;
+	}
+
+	clone_glyph_origins = true;
+
+	auto cache_iterator = layer_cache.find(font_effect->GetFingerprint());
+	if (cache_iterator != layer_cache.end() && cache_iterator->second != layer)
+		return cache_iterator->second;
+
+	return nullptr;
+}
+
 } // namespace Rml
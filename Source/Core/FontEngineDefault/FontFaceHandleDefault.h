@@ -95,7 +95,8 @@ public:
 	/// @return The width, in pixels, of the string geometry.
 	int GenerateString(GeometryList& geometry, const String& string, Vector2f position, Colourb colour, int layer_configuration = 0);
 
-	/// Version is changed whenever the layers are dirtied, requiring regeneration of string geometry.
+	/// Version is changed whenever the layers are regenerated, requiring regeneration of string geometry.
+	/// New glyphs are usually added to the existing layers without changing the version.
 	int GetVersion() const;
 
 private:
@@ -114,7 +115,7 @@ private:
 	/// @return The font glyph for the returned code point.
 	const FontGlyph* GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts = true);
 
-	// Regenerate layers if dirty, such as after adding new glyphs.
+	// Add new glyphs to the layers, or regenerate the layers if they don't fit.
 	bool UpdateLayersOnDirty();
 
 	// Create a new layer from the given font effect if it does not already exist.
@@ -123,6 +124,9 @@ private:
 	// (Re-)generate a layer in this font face handle.
 	bool GenerateLayer(FontFaceLayer* layer);
 
+	// Returns the layer, if any, which the given layer should copy its geometry and textures from.
+	FontFaceLayer* GetCloneLayer(const FontFaceLayer* layer, bool& clone_glyph_origins) const;
+
 	FontGlyphMap glyphs;
 
 	struct EffectLayerPair {
@@ -150,6 +154,9 @@ private:
 	bool is_layers_dirty = false;
 	int version = 0;
 
+	// Glyphs added since the layers were last updated.
+	Vector<Character> appended_glyphs;
+
 	// All configurations currently in use on this handle. New configurations will be generated as required.
 	LayerConfigurationList layer_configurations;
 
@@ -45,8 +45,7 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 {
 	// Clear the old layout if it exists.
 	{
-		// @performance: We could be much smarter about this, e.g. such as adding new glyphs to the existing texture layout and textures.
-		// Right now we re-generate the whole thing, including textures.
+		// New glyphs are normally added through AppendGlyphs(), we only get here when they did not fit in the existing textures.
 		texture_layout = TextureLayout{};
 		character_boxes.clear();
 		textures.clear();
@@ -101,21 +100,10 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 			Character character = pair.first;
 			const FontGlyph& glyph = pair.second;
 
-			Vector2i glyph_origin(0, 0);
-			Vector2i glyph_dimensions = glyph.bitmap_dimensions;
-
-			// Adjust glyph origin / dimensions for the font effect.
-			if (effect)
-			{
-				if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
-					continue;
-			}
-
 			TextureBox box;
-			box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
-			box.dimensions = Vector2f(glyph_dimensions);
-			
-			RMLUI_ASSERT(box.dimensions.x >= 0 && box.dimensions.y >= 0);
+			Vector2i glyph_dimensions;
+			if (!CreateTextureBox(box, glyph_dimensions, glyph))
+				continue;
 
 			character_boxes[character] = box;
 
@@ -136,19 +124,10 @@ bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFace
 		for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
 		{
 			TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-			const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
 			Character character = (Character)rectangle.GetId();
 			RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
-			TextureBox& box = character_boxes[character];
 
-			// Set the character's texture index.
-			box.texture_index = rectangle.GetTextureIndex();
-
-			// Generate the character's texture coordinates.
-			box.texcoords[0].x = float(rectangle.GetPosition().x) / float(texture.GetDimensions().x);
-			box.texcoords[0].y = float(rectangle.GetPosition().y) / float(texture.GetDimensions().y);
-			box.texcoords[1].x = float(rectangle.GetPosition().x + rectangle.GetDimensions().x) / float(texture.GetDimensions().x);
-			box.texcoords[1].y = float(rectangle.GetPosition().y + rectangle.GetDimensions().y) / float(texture.GetDimensions().y);
+			PlaceTextureBox(character_boxes[character], rectangle);
 		}
 
 		const FontEffect* effect_ptr = effect.get();
@@ -199,35 +178,142 @@ bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vecto
 		if (it == glyphs.end())
 			continue;
 
-		const FontGlyph& glyph = it->second;
+		WriteGlyphTexture(rectangle.GetTextureData(), rectangle.GetTextureStride(), box, it->second);
+	}
+
+	return true;
+}
+
+bool FontFaceLayer::AppendGlyphs(const FontFaceHandleDefault* handle, const Vector<Character>& characters, const FontFaceLayer* clone, bool clone_glyph_origins)
+{
+	const FontGlyphMap& glyphs = handle->GetGlyphs();
 
-		if (effect == nullptr)
+	if (clone)
+	{
+		// The cloned layer has already added the glyphs to the textures we share with it, only the boxes need to be copied.
+		for (Character character : characters)
 		{
-			// Copy the glyph's bitmap data into its allocated texture.
-			if (glyph.bitmap_data)
-			{
-				byte* destination = rectangle.GetTextureData();
-				const byte* source = glyph.bitmap_data;
+			auto it_glyph = glyphs.find(character);
+			auto it_box = clone->character_boxes.find(character);
+			if (it_glyph == glyphs.end() || it_box == clone->character_boxes.end())
+				continue;
 
-				for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
-				{
-					for (int k = 0; k < glyph.bitmap_dimensions.x; ++k)
-						destination[k * 4 + 3] = source[k];
+			TextureBox box = it_box->second;
 
-					destination += rectangle.GetTextureStride();
-					source += glyph.bitmap_dimensions.x;
-				}
+			if (effect && !clone_glyph_origins)
+			{
+				Vector2i glyph_origin(Math::RealToInteger(box.origin.x), Math::RealToInteger(box.origin.y));
+				Vector2i glyph_dimensions(Math::RealToInteger(box.dimensions.x), Math::RealToInteger(box.dimensions.y));
+
+				if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, it_glyph->second))
+					box.origin = Vector2f(glyph_origin);
+				else
+					box.texture_index = -1;
 			}
+
+			character_boxes[character] = box;
 		}
-		else
-		{
-			effect->GenerateGlyphTexture(rectangle.GetTextureData(), Vector2i(Math::RealToInteger(box.dimensions.x), Math::RealToInteger(box.dimensions.y)), rectangle.GetTextureStride(), glyph);
-		}
+
+		return true;
 	}
 
+	for (Character character : characters)
+	{
+		auto it_glyph = glyphs.find(character);
+		if (it_glyph == glyphs.end() || character_boxes.count(character))
+			continue;
+
+		const FontGlyph& glyph = it_glyph->second;
+
+		TextureBox box;
+		Vector2i glyph_dimensions;
+		if (!CreateTextureBox(box, glyph_dimensions, glyph))
+			continue;
+
+		const int rectangle_index = texture_layout.InsertRectangle((int)character, glyph_dimensions);
+		if (rectangle_index < 0)
+			return false;
+
+		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(rectangle_index);
+		PlaceTextureBox(box, rectangle);
+		character_boxes[character] = box;
+
+		if (glyph_dimensions.x <= 0 || glyph_dimensions.y <= 0)
+			continue;
+
+		// Upload only the region of the new glyph to the textures which have already been generated.
+		UniquePtr<byte[]> glyph_data(new byte[glyph_dimensions.x * glyph_dimensions.y * 4]);
+		for (int i = 0; i < glyph_dimensions.x * glyph_dimensions.y; i++)
+			((unsigned int*)(glyph_data.get()))[i] = 0x00ffffff;
+
+		WriteGlyphTexture(glyph_data.get(), glyph_dimensions.x * 4, box, glyph);
+
+		if (!textures[box.texture_index].Update(glyph_data.get(), glyph_dimensions, rectangle.GetPosition()))
+			return false;
+	}
+
+	return true;
+}
+
+bool FontFaceLayer::CreateTextureBox(TextureBox& box, Vector2i& glyph_dimensions, const FontGlyph& glyph) const
+{
+	Vector2i glyph_origin(0, 0);
+	glyph_dimensions = glyph.bitmap_dimensions;
+
+	// Adjust glyph origin / dimensions for the font effect.
+	if (effect)
+	{
+		if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
+			return false;
+	}
+
+	box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
+	box.dimensions = Vector2f(glyph_dimensions);
+
+	RMLUI_ASSERT(box.dimensions.x >= 0 && box.dimensions.y >= 0);
+
 	return true;
 }
 
+void FontFaceLayer::PlaceTextureBox(TextureBox& box, TextureLayoutRectangle& rectangle)
+{
+	const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
+
+	// Set the character's texture index.
+	box.texture_index = rectangle.GetTextureIndex();
+
+	// Generate the character's texture coordinates.
+	box.texcoords[0].x = float(rectangle.GetPosition().x) / float(texture.GetDimensions().x);
+	box.texcoords[0].y = float(rectangle.GetPosition().y) / float(texture.GetDimensions().y);
+	box.texcoords[1].x = float(rectangle.GetPosition().x + rectangle.GetDimensions().x) / float(texture.GetDimensions().x);
+	box.texcoords[1].y = float(rectangle.GetPosition().y + rectangle.GetDimensions().y) / float(texture.GetDimensions().y);
+}
+
+void FontFaceLayer::WriteGlyphTexture(byte* destination, int stride, const TextureBox& box, const FontGlyph& glyph) const
+{
+	if (effect == nullptr)
+	{
+		// Copy the glyph's bitmap data into its allocated texture.
+		if (glyph.bitmap_data)
+		{
+			const byte* source = glyph.bitmap_data;
+
+			for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+			{
+				for (int k = 0; k < glyph.bitmap_dimensions.x; ++k)
+					destination[k * 4 + 3] = source[k];
+
+				destination += stride;
+				source += glyph.bitmap_dimensions.x;
+			}
+		}
+	}
+	else
+	{
+		effect->GenerateGlyphTexture(destination, Vector2i(Math::RealToInteger(box.dimensions.x), Math::RealToInteger(box.dimensions.y)), stride, glyph);
+	}
+}
+
 // Returns the effect used to generate the layer.
 const FontEffect* FontFaceLayer::GetFontEffect() const
 {
@@ -60,6 +60,15 @@ public:
 	/// @return True if the layer was generated successfully, false if not.
 	bool Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
 
+	/// Adds new glyphs to a generated layer, without moving any existing glyphs. The glyphs are placed in the free space
+	/// of the existing textures, and only their regions of the textures are updated.
+	/// @param[in] handle The handle generating this layer.
+	/// @param[in] characters The characters recently added to the handle's glyphs.
+	/// @param[in] clone The layer this layer was generated from, if any. It must already contain the new glyphs.
+	/// @param[in] clone_glyph_origins True to keep the origins of the cloned glyphs, as given to Generate().
+	/// @return True if the glyphs were added, false if the layer needs to be generated again.
+	bool AppendGlyphs(const FontFaceHandleDefault* handle, const Vector<Character>& characters, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
+
 	/// Generates the texture data for a layer (for the texture database).
 	/// @param[out] texture_data The pointer to be set to the generated texture data.
 	/// @param[out] texture_dimensions The dimensions of the texture.
@@ -113,8 +122,6 @@ public:
 	Colourb GetColour() const;
 
 private:
-
-
 	struct TextureBox
 	{
 		TextureBox() : texture_index(-1) { }
@@ -130,6 +137,13 @@ private:
 		int texture_index;
 	};
 
+	// Creates the texture box for a glyph, adjusted for the font effect. Returns false if the effect does not apply to the glyph.
+	bool CreateTextureBox(TextureBox& box, Vector2i& glyph_dimensions, const FontGlyph& glyph) const;
+	// Sets the texture index and coordinates of a box from its rectangle in the texture layout.
+	void PlaceTextureBox(TextureBox& box, TextureLayoutRectangle& rectangle);
+	// Writes the glyph's bitmap, or the effect generated from it, into the given texture data.
+	void WriteGlyphTexture(byte* destination, int stride, const TextureBox& box, const FontGlyph& glyph) const;
+
 	using CharacterMap = UnorderedMap<Character, TextureBox>;
 	using TextureList = Vector<Texture>;
 
@@ -32,7 +32,9 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "GeometryArena.h"
 #include "GeometryDatabase.h"
+#include "RenderCommandRecorder.h"
 #include <utility>
 
 
@@ -66,13 +68,23 @@ void Geometry::MoveFrom(Geometry& other)
 	host_context = std::exchange(other.host_context, nullptr);
 	host_element = std::exchange(other.host_element, nullptr);
 
+	if (arena)
+		arena->Erase(arena_handle);
+
 	vertices = std::move(other.vertices);
 	indices = std::move(other.indices);
 
+	arena = std::move(other.arena);
+	arena_handle = std::exchange(other.arena_handle, -1);
+
 	texture = std::exchange(other.texture, nullptr);
 
 	compiled_geometry = std::exchange(other.compiled_geometry, 0);
 	compile_attempted = std::exchange(other.compile_attempted, false);
+
+	translucent_vertices = std::move(other.translucent_vertices);
+	translucent_opacity = std::exchange(other.translucent_opacity, 1.f);
+	other.translucent_vertices.clear();
 }
 
 Geometry::~Geometry()
@@ -80,6 +92,9 @@ Geometry::~Geometry()
 	GeometryDatabase::Erase(database_handle);
 
 	Release();
+
+	if (arena)
+		arena->Erase(arena_handle);
 }
 
 // Set the host element for this geometry; this should be passed in the constructor if possible.
@@ -97,59 +112,116 @@ void Geometry::SetHostElement(Element* _host_element)
 	host_element = _host_element;
 }
 
-void Geometry::Render(Vector2f translation)
+void Geometry::Render(Vector2f translation, float opacity)
 {
 	RenderInterface* const render_interface = GetRenderInterface();
-	if (!render_interface)
+	if (!render_interface || opacity <= 0.f)
+		return;
+
+	// Geometry is not rendered while its texture is loaded asynchronously, leaving a transparent placeholder.
+	if (texture && !texture->GetHandle(render_interface) && texture->IsLoading(render_interface))
 		return;
 
 	translation = translation.Round();
 
+	// While the host context is recording render commands, the geometry is added to its command list instead.
+	RenderCommandRecorder* const recorder = (host_context ? host_context->GetActiveRenderCommandRecorder() : nullptr);
+
+	const bool translucent = (opacity < 1.f);
+	if (!translucent && !translucent_vertices.empty())
+	{
+		translucent_vertices = Vector< Vertex >();
+		translucent_opacity = 1.f;
+	}
+
+	Vertex* vertex_data = nullptr;
+	int num_vertices = 0;
+	int* index_data = nullptr;
+	int num_indices = 0;
+
+	// Try to compile the geometry if we haven't already done so, translucent geometry is compiled too so that it can be
+	// reused while the opacity changes.
+	if (!compile_attempted)
+	{
+		if (!GetRenderData(vertex_data, num_vertices, index_data, num_indices))
+			return;
+
+		compile_attempted = true;
+		compiled_geometry = render_interface->CompileGeometry(vertex_data, num_vertices, index_data, num_indices, texture ? texture->GetHandle(render_interface) : 0);
+	}
+
 	// Render our compiled geometry if possible.
 	if (compiled_geometry)
 	{
 		RMLUI_ZoneScopedN("RenderCompiled");
-		render_interface->RenderCompiledGeometry(compiled_geometry, translation);
-	}
-	// Otherwise, if we actually have geometry, try to compile it if we haven't already done so, otherwise render it in
-	// immediate mode.
-	else
-	{
-		if (vertices.empty() ||
-			indices.empty())
+		if (recorder)
+		{
+			const TextureHandle texture_handle = (texture ? texture->GetHandle(render_interface) : 0);
+			if (!translucent)
+				recorder->RenderCompiledGeometry(compiled_geometry, texture_handle, translation);
+			else if (vertex_data || GetRenderData(vertex_data, num_vertices, index_data, num_indices))
+				recorder->RenderCompiledGeometry(compiled_geometry, texture_handle, translation, opacity, vertex_data, num_vertices, index_data, num_indices);
+			return;
+		}
+
+		if (!translucent)
+		{
+			render_interface->RenderCompiledGeometry(compiled_geometry, translation);
 			return;
+		}
+
+		if (render_interface->RenderCompiledGeometryWithOpacity(compiled_geometry, translation, opacity))
+			return;
+	}
 
-		RMLUI_ZoneScopedN("RenderGeometry");
+	// Either we've attempted to compile before (and failed), or the render interface can't apply the opacity to the
+	// compiled geometry; either way, render the uncompiled version.
+	RMLUI_ZoneScopedN("RenderGeometry");
 
-		if (!compile_attempted)
+	if (!vertex_data && !GetRenderData(vertex_data, num_vertices, index_data, num_indices))
+		return;
+
+	const TextureHandle texture_handle = (texture ? texture->GetHandle(render_interface) : 0);
+
+	// The recorder copies the vertices into its command list, and applies the opacity while doing so.
+	if (recorder)
+	{
+		recorder->RenderGeometry(vertex_data, num_vertices, index_data, num_indices, texture_handle, translation, opacity);
+		return;
+	}
+
+	if (translucent)
+	{
+		// Scale the vertex alpha into a copy instead of regenerating the geometry, the copy is kept until the opacity
+		// or the geometry changes.
+		if (translucent_vertices.empty() || translucent_opacity != opacity)
 		{
-			compile_attempted = true;
-			compiled_geometry = render_interface->CompileGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(render_interface) : 0);
-
-			// If we managed to compile the geometry, we can clear the local copy of vertices and indices and
-			// immediately render the compiled version.
-			if (compiled_geometry)
-			{	
-				render_interface->RenderCompiledGeometry(compiled_geometry, translation);
-				return;
-			}
+			translucent_vertices.assign(vertex_data, vertex_data + num_vertices);
+			for (Vertex& vertex : translucent_vertices)
+				vertex.colour.alpha = (byte)(opacity * (float)vertex.colour.alpha);
+			translucent_opacity = opacity;
 		}
 
-		// Either we've attempted to compile before (and failed), or the compile we just attempted failed; either way,
-		// render the uncompiled version.
-		render_interface->RenderGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(GetRenderInterface()) : 0, translation);
+		vertex_data = translucent_vertices.data();
 	}
+
+	render_interface->RenderGeometry(vertex_data, num_vertices, index_data, num_indices, texture_handle, translation);
 }
 
 // Returns the geometry's vertices. If these are written to, Release() should be called to force a recompile.
 Vector< Vertex >& Geometry::GetVertices()
 {
+	if (arena)
+		MoveOutOfArena();
+	translucent_vertices.clear();
 	return vertices;
 }
 
 // Returns the geometry's indices. If these are written to, Release() should be called to force a recompile.
 Vector< int >& Geometry::GetIndices()
 {
+	if (arena)
+		MoveOutOfArena();
 	return indices;
 }
 
@@ -174,18 +246,80 @@ void Geometry::Release(bool clear_buffers)
 		compiled_geometry = 0;
 	}
 
+	// Any recorded commands may refer to the released geometry or an outdated copy of its vertices. Geometry is
+	// regenerated right before it is rendered, so there is no need to record again when released during recording.
+	if (host_context && !host_context->GetActiveRenderCommandRecorder())
+		host_context->DirtyRenderCommands();
+
 	compile_attempted = false;
 
+	translucent_vertices.clear();
+	translucent_opacity = 1.f;
+
 	if (clear_buffers)
 	{
 		vertices.clear();
 		indices.clear();
+
+		if (arena)
+		{
+			arena->Erase(arena_handle);
+			arena.reset();
+			arena_handle = -1;
+		}
 	}
 }
 
 Geometry::operator bool() const
 {
-	return !indices.empty();
+	return !indices.empty() || arena;
+}
+
+void Geometry::MoveIntoArena()
+{
+	RMLUI_ASSERT(!arena);
+	if (!host_context || !host_context->geometry_arena)
+		return;
+
+	arena = host_context->geometry_arena;
+	arena_handle = arena->Insert(vertices, indices);
+}
+
+void Geometry::MoveOutOfArena()
+{
+	RMLUI_ASSERT(arena);
+	arena->Extract(arena_handle, vertices, indices);
+	arena.reset();
+	arena_handle = -1;
+}
+
+bool Geometry::GetRenderData(Vertex*& out_vertices, int& out_num_vertices, int*& out_indices, int& out_num_indices)
+{
+	if (!arena)
+	{
+		if (vertices.empty() || indices.empty())
+			return false;
+
+		MoveIntoArena();
+	}
+
+	if (arena)
+	{
+		const GeometryArena::Span span = arena->Get(arena_handle);
+		out_vertices = span.vertices;
+		out_num_vertices = span.num_vertices;
+		out_indices = span.indices;
+		out_num_indices = span.num_indices;
+	}
+	else
+	{
+		out_vertices = &vertices[0];
+		out_num_vertices = (int)vertices.size();
+		out_indices = &indices[0];
+		out_num_indices = (int)indices.size();
+	}
+
+	return true;
 }
 
 // Returns the host context's render interface.
@@ -0,0 +1,227 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "GeometryArena.h"
+#include <algorithm>
+
+namespace Rml {
+
+// Vertex slabs of about 240 kB, with index slabs sized for quads of four vertices and six indices. Geometry larger than a
+// slab is given a dedicated slab.
+static constexpr int vertex_slab_size = 12 * 1024;
+static constexpr int index_slab_size = 18 * 1024;
+
+template <typename T>
+typename GeometryArenaSlabs<T>::Block GeometryArenaSlabs<T>::Allocate(const int size)
+{
+	RMLUI_ASSERT(size > 0);
+
+	// First fit, the slabs are typically few, and their free lists short.
+	for (int slab_index = 0; slab_index < (int)slabs.size(); slab_index++)
+	{
+		Slab& slab = slabs[slab_index];
+		for (auto it = slab.free_ranges.begin(); it != slab.free_ranges.end(); ++it)
+		{
+			if (it->size < size)
+				continue;
+
+			Block block;
+			block.slab = slab_index;
+			block.offset = it->offset;
+			block.size = size;
+
+			it->offset += size;
+			it->size -= size;
+			if (it->size == 0)
+				slab.free_ranges.erase(it);
+
+			slab.num_used += size;
+			return block;
+		}
+	}
+
+	// No room in any existing slab, re-use the slot of a released slab or add a new one.
+	auto it_slab = std::find_if(slabs.begin(), slabs.end(), [](const Slab& slab) { return slab.data.empty(); });
+	if (it_slab == slabs.end())
+	{
+		slabs.emplace_back();
+		it_slab = slabs.end() - 1;
+	}
+
+	Slab& slab = *it_slab;
+	const int new_slab_size = std::max(size, slab_size);
+	slab.data.resize((size_t)new_slab_size);
+	slab.num_used = size;
+	if (new_slab_size > size)
+		slab.free_ranges.push_back(Range{ size, new_slab_size - size });
+
+	Block block;
+	block.slab = int(it_slab - slabs.begin());
+	block.offset = 0;
+	block.size = size;
+	return block;
+}
+
+template <typename T>
+void GeometryArenaSlabs<T>::Free(const Block block)
+{
+	RMLUI_ASSERT(block.slab >= 0 && block.slab < (int)slabs.size());
+	Slab& slab = slabs[block.slab];
+
+	slab.num_used -= block.size;
+	if (slab.num_used == 0)
+	{
+		// Release the memory of empty slabs, so that the arena shrinks back after a peak.
+		Vector<T>().swap(slab.data);
+		slab.free_ranges.clear();
+		return;
+	}
+
+	Vector<Range>& ranges = slab.free_ranges;
+	auto it_next = std::lower_bound(ranges.begin(), ranges.end(), block.offset, [](const Range& range, int offset) { return range.offset < offset; });
+
+	const bool merge_prev = (it_next != ranges.begin() && (it_next - 1)->offset + (it_next - 1)->size == block.offset);
+	const bool merge_next = (it_next != ranges.end() && block.offset + block.size == it_next->offset);
+
+	if (merge_prev && merge_next)
+	{
+		(it_next - 1)->size += block.size + it_next->size;
+		ranges.erase(it_next);
+	}
+	else if (merge_prev)
+	{
+		(it_next - 1)->size += block.size;
+	}
+	else if (merge_next)
+	{
+		it_next->offset = block.offset;
+		it_next->size += block.size;
+	}
+	else
+	{
+		ranges.insert(it_next, Range{ block.offset, block.size });
+	}
+}
+
+template <typename T>
+int GeometryArenaSlabs<T>::GetNumSlabs() const
+{
+	return (int)std::count_if(slabs.begin(), slabs.end(), [](const Slab& slab) { return !slab.data.empty(); });
+}
+
+template class GeometryArenaSlabs<Vertex>;
+template class GeometryArenaSlabs<int>;
+
+
+GeometryArena::GeometryArena() : vertex_slabs(vertex_slab_size), index_slabs(index_slab_size)
+{}
+
+GeometryArena::~GeometryArena()
+{
+	RMLUI_ASSERTMSG(GetNumGeometries() == 0, "All geometry should be removed from the arena before it is destroyed.");
+}
+
+int GeometryArena::Insert(Vector<Vertex>& vertices, Vector<int>& indices)
+{
+	Entry entry;
+	if (!vertices.empty())
+	{
+		entry.vertices = vertex_slabs.Allocate((int)vertices.size());
+		std::copy(vertices.begin(), vertices.end(), vertex_slabs.GetData(entry.vertices));
+	}
+	if (!indices.empty())
+	{
+		entry.indices = index_slabs.Allocate((int)indices.size());
+		std::copy(indices.begin(), indices.end(), index_slabs.GetData(entry.indices));
+	}
+
+	Vector<Vertex>().swap(vertices);
+	Vector<int>().swap(indices);
+
+	if (!free_entries.empty())
+	{
+		const int handle = free_entries.back();
+		free_entries.pop_back();
+		entries[handle] = entry;
+		return handle;
+	}
+
+	entries.push_back(entry);
+	return (int)entries.size() - 1;
+}
+
+void GeometryArena::Extract(int handle, Vector<Vertex>& vertices, Vector<int>& indices)
+{
+	const Span span = Get(handle);
+	vertices.assign(span.vertices, span.vertices + span.num_vertices);
+	indices.assign(span.indices, span.indices + span.num_indices);
+
+	Erase(handle);
+}
+
+void GeometryArena::Erase(int handle)
+{
+	Entry& entry = entries[handle];
+	if (entry.vertices.size > 0)
+		vertex_slabs.Free(entry.vertices);
+	if (entry.indices.size > 0)
+		index_slabs.Free(entry.indices);
+
+	entry = Entry();
+	free_entries.push_back(handle);
+}
+
+GeometryArena::Span GeometryArena::Get(int handle)
+{
+	const Entry& entry = entries[handle];
+
+	Span span = {};
+	if (entry.vertices.size > 0)
+	{
+		span.vertices = vertex_slabs.GetData(entry.vertices);
+		span.num_vertices = entry.vertices.size;
+	}
+	if (entry.indices.size > 0)
+	{
+		span.indices = index_slabs.GetData(entry.indices);
+		span.num_indices = entry.indices.size;
+	}
+	return span;
+}
+
+int GeometryArena::GetNumGeometries() const
+{
+	return (int)entries.size() - (int)free_entries.size();
+}
+
+int GeometryArena::GetNumVertexSlabs() const
+{
+	return vertex_slabs.GetNumSlabs();
+}
+
+} // namespace Rml
@@ -0,0 +1,125 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_GEOMETRYARENA_H
+#define RMLUI_CORE_GEOMETRYARENA_H
+
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/Vertex.h"
+
+namespace Rml {
+
+/**
+	Sub-allocates ranges of a few large slabs, freed ranges are coalesced and reused by later allocations.
+ */
+
+template <typename T>
+class GeometryArenaSlabs : NonCopyMoveable {
+public:
+	struct Block {
+		int slab = -1;
+		int offset = 0;
+		int size = 0;
+	};
+
+	GeometryArenaSlabs(int slab_size) : slab_size(slab_size) {}
+
+	Block Allocate(int size);
+	void Free(Block block);
+
+	T* GetData(Block block) { return slabs[block.slab].data.data() + block.offset; }
+
+	int GetNumSlabs() const;
+
+private:
+	struct Range {
+		int offset;
+		int size;
+	};
+	struct Slab {
+		Vector<T> data;
+		// Free ranges, sorted by offset and never adjacent.
+		Vector<Range> free_ranges;
+		int num_used = 0;
+	};
+
+	int slab_size;
+	Vector<Slab> slabs;
+};
+
+/**
+	Stores the vertices and indices of geometry in large, shared slabs instead of a pair of allocations per geometry.
+
+	Geometry is moved into the arena once it is rendered, and moved back into its own buffers whenever it is modified.
+	See Context::EnableGeometryArena().
+ */
+
+class GeometryArena : NonCopyMoveable {
+public:
+	struct Span {
+		Vertex* vertices;
+		int num_vertices;
+		int* indices;
+		int num_indices;
+	};
+
+	GeometryArena();
+	~GeometryArena();
+
+	/// Moves the vertices and indices into the arena, releasing the memory of the provided buffers.
+	/// @return A handle to the stored geometry.
+	int Insert(Vector<Vertex>& vertices, Vector<int>& indices);
+	/// Moves the geometry back into the provided buffers, and frees its space in the arena.
+	void Extract(int handle, Vector<Vertex>& vertices, Vector<int>& indices);
+	/// Frees the space of the geometry in the arena.
+	void Erase(int handle);
+
+	/// Returns the vertices and indices of the geometry, which remain valid until the geometry is extracted or erased.
+	Span Get(int handle);
+
+	/// Returns the number of geometries currently stored in the arena.
+	int GetNumGeometries() const;
+	/// Returns the number of slabs currently holding vertices.
+	int GetNumVertexSlabs() const;
+
+private:
+	struct Entry {
+		GeometryArenaSlabs<Vertex>::Block vertices;
+		GeometryArenaSlabs<int>::Block indices;
+	};
+
+	GeometryArenaSlabs<Vertex> vertex_slabs;
+	GeometryArenaSlabs<int> index_slabs;
+
+	Vector<Entry> entries;
+	Vector<int> free_entries;
+};
+
+} // namespace Rml
+#endif
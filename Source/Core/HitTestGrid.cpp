@@ -0,0 +1,174 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "HitTestGrid.h"
+#include "TransformState.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include <cfloat>
+#include <cmath>
+
+namespace Rml {
+
+// Upper limit on the number of cells along each axis.
+static constexpr int max_cells_per_axis = 64;
+
+HitTestGrid::HitTestGrid() : built(false), built_generation(0), origin(0, 0), cell_size(1, 1), num_cells(0, 0)
+{}
+
+void HitTestGrid::Build(const ElementList& stacking_context, unsigned int generation)
+{
+	RMLUI_ZoneScoped;
+
+	built = true;
+	built_generation = generation;
+
+	num_cells = Vector2i(0, 0);
+	cell_offsets.clear();
+	cell_elements.clear();
+	unindexed_elements.clear();
+
+	struct ElementBounds {
+		int index;
+		Vector2f top_left;
+		Vector2f bottom_right;
+	};
+	Vector<ElementBounds> indexed_elements;
+	indexed_elements.reserve(stacking_context.size());
+
+	Vector2f grid_top_left(FLT_MAX, FLT_MAX);
+	Vector2f grid_bottom_right(-FLT_MAX, -FLT_MAX);
+
+	for (int i = 0; i < (int)stacking_context.size(); i++)
+	{
+		Element* element = stacking_context[i];
+
+		// Elements in their own stacking context may have descendants outside their bounds, and transformed elements
+		// are projected before testing their boxes. This also applies to elements whose transform is not yet resolved.
+		const TransformState* transform_state = element->GetTransformState();
+		if (element->local_stacking_context || element->dirty_transform || (transform_state && transform_state->GetTransform()))
+		{
+			unindexed_elements.push_back(i);
+			continue;
+		}
+
+		const int num_boxes = element->GetNumBoxes();
+		if (num_boxes == 0)
+			continue;
+
+		const Vector2f position = element->GetAbsoluteOffset(Box::BORDER);
+
+		ElementBounds bounds = { i, Vector2f(FLT_MAX, FLT_MAX), Vector2f(-FLT_MAX, -FLT_MAX) };
+		for (int j = 0; j < num_boxes; j++)
+		{
+			Vector2f box_offset;
+			const Box& box = element->GetBox(j, box_offset);
+			const Vector2f box_position = position + box_offset;
+			const Vector2f box_dimensions = box.GetSize(Box::BORDER);
+
+			bounds.top_left.x = Math::Min(bounds.top_left.x, box_position.x);
+			bounds.top_left.y = Math::Min(bounds.top_left.y, box_position.y);
+			bounds.bottom_right.x = Math::Max(bounds.bottom_right.x, box_position.x + box_dimensions.x);
+			bounds.bottom_right.y = Math::Max(bounds.bottom_right.y, box_position.y + box_dimensions.y);
+		}
+
+		grid_top_left.x = Math::Min(grid_top_left.x, bounds.top_left.x);
+		grid_top_left.y = Math::Min(grid_top_left.y, bounds.top_left.y);
+		grid_bottom_right.x = Math::Max(grid_bottom_right.x, bounds.bottom_right.x);
+		grid_bottom_right.y = Math::Max(grid_bottom_right.y, bounds.bottom_right.y);
+
+		indexed_elements.push_back(bounds);
+	}
+
+	if (indexed_elements.empty())
+		return;
+
+	// Aim for a handful of elements per cell.
+	const int cells_per_axis = Math::Clamp((int)std::sqrt(float(indexed_elements.size()) * 0.25f), 1, max_cells_per_axis);
+	const Vector2f grid_size = grid_bottom_right - grid_top_left;
+
+	origin = grid_top_left;
+	num_cells = Vector2i(grid_size.x > 0.f ? cells_per_axis : 1, grid_size.y > 0.f ? cells_per_axis : 1);
+	cell_size = Vector2f(grid_size.x > 0.f ? grid_size.x / float(num_cells.x) : 1.f, grid_size.y > 0.f ? grid_size.y / float(num_cells.y) : 1.f);
+
+	auto cell_range = [this](const ElementBounds& bounds, Vector2i& first, Vector2i& last) {
+		first.x = Math::Clamp(int((bounds.top_left.x - origin.x) / cell_size.x), 0, num_cells.x - 1);
+		first.y = Math::Clamp(int((bounds.top_left.y - origin.y) / cell_size.y), 0, num_cells.y - 1);
+		last.x = Math::Clamp(int((bounds.bottom_right.x - origin.x) / cell_size.x), 0, num_cells.x - 1);
+		last.y = Math::Clamp(int((bounds.bottom_right.y - origin.y) / cell_size.y), 0, num_cells.y - 1);
+	};
+
+	// Count the elements of each cell, then fill in the element indices in stacking order.
+	const int total_cells = num_cells.x * num_cells.y;
+	cell_offsets.assign(total_cells + 1, 0);
+
+	for (const ElementBounds& bounds : indexed_elements)
+	{
+		Vector2i first, last;
+		cell_range(bounds, first, last);
+		for (int y = first.y; y <= last.y; y++)
+			for (int x = first.x; x <= last.x; x++)
+				cell_offsets[y * num_cells.x + x + 1] += 1;
+	}
+
+	for (int i = 0; i < total_cells; i++)
+		cell_offsets[i + 1] += cell_offsets[i];
+
+	Vector<int> cell_fill(cell_offsets.begin(), cell_offsets.end() - 1);
+	cell_elements.resize(cell_offsets.back());
+
+	for (const ElementBounds& bounds : indexed_elements)
+	{
+		Vector2i first, last;
+		cell_range(bounds, first, last);
+		for (int y = first.y; y <= last.y; y++)
+			for (int x = first.x; x <= last.x; x++)
+				cell_elements[cell_fill[y * num_cells.x + x]++] = bounds.index;
+	}
+}
+
+int HitTestGrid::GetCellIndex(Vector2f point) const
+{
+	if (num_cells.x == 0 || num_cells.y == 0)
+		return -1;
+
+	const Vector2f relative_point = point - origin;
+	if (relative_point.x < 0.f || relative_point.y < 0.f)
+		return -1;
+
+	const int x = Math::Min(int(relative_point.x / cell_size.x), num_cells.x - 1);
+	const int y = Math::Min(int(relative_point.y / cell_size.y), num_cells.y - 1);
+
+	// Points beyond the far edges of the grid are outside all indexed elements.
+	if (relative_point.x > float(num_cells.x) * cell_size.x + 1.f || relative_point.y > float(num_cells.y) * cell_size.y + 1.f)
+		return -1;
+
+	return y * num_cells.x + x;
+}
+
+} // namespace Rml
@@ -0,0 +1,118 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_HITTESTGRID_H
+#define RMLUI_CORE_HITTESTGRID_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+	A uniform grid of the border boxes of the elements in a local stacking context, used to accelerate hit testing.
+
+	Each cell lists the stacking context indices of the elements whose bounds overlap the cell, in ascending order.
+	Elements whose area cannot be determined from their boxes alone, such as transformed elements and elements with
+	their own local stacking context, are kept in a separate list which is tested for every point. The grid is built
+	from the current layout and is rebuilt when the context's hit test generation changes.
+ */
+
+class HitTestGrid : NonCopyMoveable {
+public:
+	/// Local stacking contexts with fewer elements than this are tested linearly.
+	static constexpr int MinimumElements = 64;
+
+	HitTestGrid();
+
+	/// Builds the grid from the elements of the given stacking context.
+	void Build(const ElementList& stacking_context, unsigned int generation);
+
+	/// Returns true if the grid was built during the given generation.
+	bool IsValid(unsigned int generation) const { return built && built_generation == generation; }
+
+	/// Calls the function with the stacking context index of every element which may contain the point, from the last
+	/// element in the stacking context to the first, until the function returns true.
+	/// @return True if the function returned true.
+	template<typename Func>
+	bool ForEachCandidate(Vector2f point, Func&& func) const;
+
+private:
+	// Returns the index of the cell containing the point, or -1 if the point is outside the grid.
+	int GetCellIndex(Vector2f point) const;
+
+	bool built;
+	unsigned int built_generation;
+
+	Vector2f origin;
+	Vector2f cell_size;
+	Vector2i num_cells;
+
+	// Element indices of all cells, with the range of cell i starting at cell_offsets[i] and ending at cell_offsets[i + 1].
+	Vector<int> cell_offsets;
+	Vector<int> cell_elements;
+
+	// Element indices which must be tested regardless of their bounds.
+	Vector<int> unindexed_elements;
+};
+
+template<typename Func>
+bool HitTestGrid::ForEachCandidate(Vector2f point, Func&& func) const
+{
+	const int* cell_begin = nullptr;
+	const int* cell_it = nullptr;
+
+	const int cell_index = GetCellIndex(point);
+	if (cell_index >= 0 && cell_offsets[cell_index] < cell_offsets[cell_index + 1])
+	{
+		cell_begin = cell_elements.data() + cell_offsets[cell_index];
+		cell_it = cell_elements.data() + cell_offsets[cell_index + 1];
+	}
+
+	const int* unindexed_begin = unindexed_elements.data();
+	const int* unindexed_it = unindexed_elements.data() + unindexed_elements.size();
+
+	// Merge the two sorted lists from the back, so that the top-most elements are visited first.
+	while (cell_it != cell_begin || unindexed_it != unindexed_begin)
+	{
+		int index;
+		if (unindexed_it == unindexed_begin || (cell_it != cell_begin && *(cell_it - 1) > *(unindexed_it - 1)))
+			index = *(--cell_it);
+		else
+			index = *(--unindexed_it);
+
+		if (func(index))
+			return true;
+	}
+
+	return false;
+}
+
+} // namespace Rml
+#endif
@@ -656,6 +656,11 @@ void LayoutBlockBox::ExtendInnerContentSize(Vector2f _inner_content_size)
 	inner_content_size.y = Math::Max(inner_content_size.y, _inner_content_size.y);
 }
 
+bool LayoutBlockBox::HasFloats() const
+{
+	return !space->IsEmpty();
+}
+
 // Returns the block box's element.
 Element* LayoutBlockBox::GetElement() const
 {
@@ -139,6 +139,9 @@ public:
 	/// Set the inner content size if it is larger than the current value on each axis individually.
 	void ExtendInnerContentSize(Vector2f inner_content_size);
 
+	/// Returns true if any floating boxes, of this box or of its ancestors, occupy the space of this box.
+	bool HasFloats() const;
+
 	/// Returns the block box's element.
 	/// @return The block box's element.
 	Element* GetElement() const;
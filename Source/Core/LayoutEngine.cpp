@@ -56,6 +56,14 @@ static Pool< LayoutChunk<ChunkSizeMedium> > layout_chunk_pool_medium(50, true);
 static Pool< LayoutChunk<ChunkSizeSmall> > layout_chunk_pool_small(50, true);
 
 
+// Returns true if the size of the element, and thereby the layout of everything outside it, is independent of its contents.
+static bool IsSizeIndependentOfContents(Element* element)
+{
+	const ComputedValues& computed = element->GetComputedValues();
+	return computed.width.type != Style::Width::Auto && computed.height.type != Style::Height::Auto &&
+		computed.overflow_x != Style::Overflow::Visible && computed.overflow_y != Style::Overflow::Visible;
+}
+
 // Formats the contents for a root-level element (usually a document or floating element).
 void LayoutEngine::FormatElement(Element* element, Vector2f containing_block, const Box* override_initial_box, Vector2f* out_visible_overflow_size)
 {
@@ -96,6 +104,11 @@ void LayoutEngine::FormatElement(Element* element, Vector2f containing_block, co
 	if (out_visible_overflow_size)
 		*out_visible_overflow_size = block_context_box->GetVisibleOverflowSize();
 
+	// Root-level elements are formatted independently of their surroundings, so we can format them again the same way as
+	// long as their size doesn't depend on their contents.
+	element->layout_boundary = (!override_initial_box && IsSizeIndependentOfContents(element));
+	element->layout_containing_block = containing_block;
+
 	element->OnLayout();
 }
 
@@ -141,6 +154,9 @@ bool LayoutEngine::FormatElement(LayoutBlockBox* block_context_box, Element* ele
 
 	auto& computed = element->GetComputedValues();
 
+	// Set again below if the element is formatted as a layout boundary.
+	element->layout_boundary = false;
+
 	// Check if we have to do any special formatting for any elements that don't fit into the standard layout scheme.
 	if (FormatElementSpecial(block_context_box, element))
 		return true;
@@ -205,6 +221,12 @@ bool LayoutEngine::FormatElementBlock(LayoutBlockBox* block_context_box, Element
 	if (new_block_context_box == nullptr)
 		return false;
 
+	// A positioned element is the offset parent of its descendants, and can then be formatted as a root-level element with
+	// the same result. Unless any floats intrude on its space, which are not known outside of this formatting context.
+	const bool layout_boundary = (element->GetPosition() != Style::Position::Static && IsSizeIndependentOfContents(element) &&
+		!new_block_context_box->HasFloats());
+	const Vector2f containing_block = LayoutDetails::GetContainingBlock(block_context_box);
+
 	// Format the element's children.
 	for (int i = 0; i < element->GetNumChildren(); i++)
 	{
@@ -240,6 +262,12 @@ bool LayoutEngine::FormatElementBlock(LayoutBlockBox* block_context_box, Element
 			element->OnLayout();
 	}
 
+	if (layout_boundary)
+	{
+		element->layout_boundary = true;
+		element->layout_containing_block = containing_block;
+	}
+
 	return true;
 }
 
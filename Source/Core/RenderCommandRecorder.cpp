@@ -0,0 +1,188 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "RenderCommandRecorder.h"
+
+namespace Rml {
+
+RenderCommandRecorder::RenderCommandRecorder()
+{
+	Clear();
+}
+
+void RenderCommandRecorder::Clear()
+{
+	command_list.vertices.clear();
+	command_list.indices.clear();
+	command_list.transforms.clear();
+	command_list.commands.clear();
+	command_list.version += 1;
+
+	scissor_enabled = false;
+	scissor_origin = Vector2i(0, 0);
+	scissor_dimensions = Vector2i(0, 0);
+	transform_index = -1;
+	last_command_mergeable = false;
+}
+
+void RenderCommandRecorder::SetScissorRegion(bool enable, Vector2i origin, Vector2i dimensions)
+{
+	if (!enable)
+	{
+		origin = Vector2i(0, 0);
+		dimensions = Vector2i(0, 0);
+	}
+
+	if (enable == scissor_enabled && origin == scissor_origin && dimensions == scissor_dimensions)
+		return;
+
+	scissor_enabled = enable;
+	scissor_origin = origin;
+	scissor_dimensions = dimensions;
+	last_command_mergeable = false;
+}
+
+void RenderCommandRecorder::SetTransform(const Matrix4f* transform)
+{
+	if (!transform)
+	{
+		if (transform_index >= 0)
+		{
+			transform_index = -1;
+			last_command_mergeable = false;
+		}
+		return;
+	}
+
+	// Reuse the current transform if it is equal.
+	if (transform_index >= 0 && command_list.transforms[transform_index] == *transform)
+		return;
+
+	transform_index = (int)command_list.transforms.size();
+	command_list.transforms.push_back(*transform);
+	last_command_mergeable = false;
+}
+
+void RenderCommandRecorder::RenderGeometry(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, TextureHandle texture, Vector2f translation, float opacity)
+{
+	if (num_vertices <= 0 || num_indices <= 0)
+		return;
+
+	RenderCommand* command = nullptr;
+	if (last_command_mergeable && command_list.commands.back().texture == texture)
+		command = &command_list.commands.back();
+
+	// Geometry merged into the previous command is moved by the difference in translation.
+	Vector2f vertex_offset;
+	if (command)
+	{
+		vertex_offset = translation - command->translation;
+	}
+	else
+	{
+		command = &AddCommand();
+		command->vertex_offset = (int)command_list.vertices.size();
+		command->index_offset = (int)command_list.indices.size();
+		command->texture = texture;
+		command->translation = translation;
+	}
+
+	AppendGeometry(vertices, num_vertices, indices, num_indices, command->num_vertices, vertex_offset, opacity);
+
+	command->num_vertices += num_vertices;
+	command->num_indices += num_indices;
+
+	last_command_mergeable = true;
+}
+
+void RenderCommandRecorder::RenderCompiledGeometry(CompiledGeometryHandle geometry, TextureHandle texture, Vector2f translation)
+{
+	RenderCommand& command = AddCommand();
+	command.compiled_geometry = geometry;
+	command.texture = texture;
+	command.translation = translation;
+
+	last_command_mergeable = false;
+}
+
+void RenderCommandRecorder::RenderCompiledGeometry(CompiledGeometryHandle geometry, TextureHandle texture, Vector2f translation, float opacity,
+	const Vertex* vertices, int num_vertices, const int* indices, int num_indices)
+{
+	RenderCommand& command = AddCommand();
+	command.compiled_geometry = geometry;
+	command.texture = texture;
+	command.translation = translation;
+	command.opacity = opacity;
+	command.vertex_offset = (int)command_list.vertices.size();
+	command.index_offset = (int)command_list.indices.size();
+	command.num_vertices = num_vertices;
+	command.num_indices = num_indices;
+
+	AppendGeometry(vertices, num_vertices, indices, num_indices, 0, Vector2f(0, 0), opacity);
+
+	last_command_mergeable = false;
+}
+
+RenderCommandList& RenderCommandRecorder::GetCommandList()
+{
+	return command_list;
+}
+
+RenderCommand& RenderCommandRecorder::AddCommand()
+{
+	command_list.commands.emplace_back();
+	RenderCommand& command = command_list.commands.back();
+	command.scissor_enabled = scissor_enabled;
+	command.scissor_origin = scissor_origin;
+	command.scissor_dimensions = scissor_dimensions;
+	command.transform_index = transform_index;
+	return command;
+}
+
+void RenderCommandRecorder::AppendGeometry(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, int index_base,
+	Vector2f vertex_offset, float opacity)
+{
+	Vector< Vertex >& list_vertices = command_list.vertices;
+	Vector< int >& list_indices = command_list.indices;
+
+	list_vertices.insert(list_vertices.end(), vertices, vertices + num_vertices);
+	if (vertex_offset != Vector2f(0, 0) || opacity < 1.f)
+	{
+		for (auto it = list_vertices.end() - num_vertices; it != list_vertices.end(); ++it)
+		{
+			it->position += vertex_offset;
+			it->colour.alpha = (byte)(opacity * (float)it->colour.alpha);
+		}
+	}
+
+	list_indices.reserve(list_indices.size() + num_indices);
+	for (int i = 0; i < num_indices; i++)
+		list_indices.push_back(indices[i] + index_base);
+}
+
+} // namespace Rml
@@ -0,0 +1,85 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_RENDERCOMMANDRECORDER_H
+#define RMLUI_CORE_RENDERCOMMANDRECORDER_H
+
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+	Records the draw calls and render state changes of a context into a render command list.
+
+	Consecutive uncompiled geometry sharing the same texture, scissor region and transform is merged into a single
+	command, with the translation baked into the vertices. Commands are never reordered, so the painter's order of the
+	element tree is preserved.
+ */
+
+class RenderCommandRecorder : NonCopyMoveable {
+public:
+	RenderCommandRecorder();
+
+	/// Clears all recorded commands, keeping allocated memory for the next recording.
+	void Clear();
+
+	/// Sets the scissor state for the following commands.
+	void SetScissorRegion(bool enable, Vector2i origin, Vector2i dimensions);
+	/// Sets the transform for the following commands, or nullptr to clear the transform.
+	void SetTransform(const Matrix4f* transform);
+
+	/// Records uncompiled geometry, the vertices and indices are copied into the command list with the opacity applied.
+	void RenderGeometry(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, TextureHandle texture, Vector2f translation, float opacity = 1.f);
+	/// Records compiled geometry.
+	void RenderCompiledGeometry(CompiledGeometryHandle geometry, TextureHandle texture, Vector2f translation);
+	/// Records translucent compiled geometry, together with a copy of its vertices and indices with the opacity applied.
+	void RenderCompiledGeometry(CompiledGeometryHandle geometry, TextureHandle texture, Vector2f translation, float opacity, const Vertex* vertices,
+		int num_vertices, const int* indices, int num_indices);
+
+	RenderCommandList& GetCommandList();
+
+private:
+	// Initializes a new command with the current render state.
+	RenderCommand& AddCommand();
+	// Copies the vertices and indices to the end of the command list, with the offset and opacity applied.
+	void AppendGeometry(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, int index_base, Vector2f vertex_offset, float opacity);
+
+	RenderCommandList command_list;
+
+	bool scissor_enabled;
+	Vector2i scissor_origin;
+	Vector2i scissor_dimensions;
+	int transform_index;
+
+	// True if the last command can be extended with more geometry.
+	bool last_command_mergeable;
+};
+
+} // namespace Rml
+#endif
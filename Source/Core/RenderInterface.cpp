@@ -52,6 +52,12 @@ void RenderInterface::RenderCompiledGeometry(CompiledGeometryHandle /*geometry*/
 {
 }
 
+// Called by RmlUi when it wants to render application-compiled geometry with an opacity.
+bool RenderInterface::RenderCompiledGeometryWithOpacity(CompiledGeometryHandle /*geometry*/, const Vector2f& /*translation*/, float /*opacity*/)
+{
+	return false;
+}
+
 // Called by RmlUi when it wants to release application-compiled geometry.
 void RenderInterface::ReleaseCompiledGeometry(CompiledGeometryHandle /*geometry*/)
 {
@@ -63,12 +69,24 @@ bool RenderInterface::LoadTexture(TextureHandle& /*texture_handle*/, Vector2i& /
 	return false;
 }
 
+// Called by RmlUi on a background thread to decode a texture.
+bool RenderInterface::DecodeTexture(UniquePtr<byte[]>& /*data*/, Vector2i& /*dimensions*/, const String& /*source*/)
+{
+	return false;
+}
+
 // Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
 bool RenderInterface::GenerateTexture(TextureHandle& /*texture_handle*/, const byte* /*source*/, const Vector2i& /*source_dimensions*/)
 {
 	return false;
 }
 
+// Called by RmlUi when a region of a previously generated texture has changed.
+bool RenderInterface::UpdateTexture(TextureHandle /*texture_handle*/, const byte* /*source*/, const Vector2i& /*source_dimensions*/, const Vector2i& /*offset*/)
+{
+	return false;
+}
+
 // Called by RmlUi when a loaded texture is no longer required.
 void RenderInterface::ReleaseTexture(TextureHandle /*texture*/)
 {
@@ -79,6 +97,44 @@ void RenderInterface::SetTransform(const Matrix4f* /*transform*/)
 {
 }
 
+// Called by RmlUi to submit all draw calls of a context at once.
+void RenderInterface::RenderCommands(RenderCommandList& command_list)
+{
+	bool first_command = true;
+	bool scissor_enabled = false;
+	Vector2i scissor_origin, scissor_dimensions;
+	int transform_index = -1;
+
+	for (const RenderCommand& command : command_list.commands)
+	{
+		if (first_command || command.scissor_enabled != scissor_enabled)
+			EnableScissorRegion(command.scissor_enabled);
+
+		if (command.scissor_enabled && (first_command || !scissor_enabled || command.scissor_origin != scissor_origin || command.scissor_dimensions != scissor_dimensions))
+			SetScissorRegion(command.scissor_origin.x, command.scissor_origin.y, command.scissor_dimensions.x, command.scissor_dimensions.y);
+
+		// Transforms are only submitted when they change, the list always starts and ends without any transform or scissoring.
+		if (command.transform_index != transform_index)
+			SetTransform(command.transform_index >= 0 ? &command_list.transforms[command.transform_index] : nullptr);
+
+		first_command = false;
+		scissor_enabled = command.scissor_enabled;
+		scissor_origin = command.scissor_origin;
+		scissor_dimensions = command.scissor_dimensions;
+		transform_index = command.transform_index;
+
+		if (command.compiled_geometry && command.opacity >= 1.f)
+			RenderCompiledGeometry(command.compiled_geometry, command.translation);
+		else if (!command.compiled_geometry || !RenderCompiledGeometryWithOpacity(command.compiled_geometry, command.translation, command.opacity))
+			RenderGeometry(&command_list.vertices[command.vertex_offset], command.num_vertices, &command_list.indices[command.index_offset], command.num_indices, command.texture, command.translation);
+	}
+
+	if (transform_index >= 0)
+		SetTransform(nullptr);
+	if (scissor_enabled)
+		EnableScissorRegion(false);
+}
+
 // Get the context currently being rendered.
 Context* RenderInterface::GetContext() const
 {
@@ -0,0 +1,132 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "StringWidthCache.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/FontEngineInterface.h"
+#include "Utilities.h"
+
+namespace Rml {
+
+// Enough for the vocabulary of several text-heavy documents, while keeping the memory footprint small.
+static constexpr size_t max_num_entries = 4096;
+
+struct StringWidthEntry {
+	FontFaceHandle handle;
+	int version;
+	Character prior_character;
+	String string;
+	int width;
+};
+
+using StringWidthList = List<StringWidthEntry>;
+
+// The most recently used entries are kept at the front of the list. The map is indexed by the combined hash of the key,
+// the full key is compared on lookup and any colliding entry is simply replaced.
+struct StringWidthCacheData {
+	StringWidthList entries;
+	UnorderedMap<size_t, StringWidthList::iterator> index;
+	int num_hits = 0;
+	int num_misses = 0;
+};
+
+static size_t HashKey(FontFaceHandle handle, int version, Character prior_character, const String& string)
+{
+	size_t hash = Hash<String>()(string);
+	Utilities::HashCombine(hash, handle);
+	Utilities::HashCombine(hash, version);
+	Utilities::HashCombine(hash, (char32_t)prior_character);
+	return hash;
+}
+
+static StringWidthCacheData& GetData()
+{
+	static StringWidthCacheData data;
+	return data;
+}
+
+int StringWidthCache::GetStringWidth(FontFaceHandle handle, const String& string, Character prior_character)
+{
+	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
+	const int version = font_engine_interface->GetVersion(handle);
+
+	const size_t hash = HashKey(handle, version, prior_character, string);
+
+	StringWidthCacheData& data = GetData();
+
+	auto it_index = data.index.find(hash);
+	if (it_index != data.index.end())
+	{
+		const StringWidthList::iterator it_entry = it_index->second;
+		const StringWidthEntry& entry = *it_entry;
+
+		if (entry.handle == handle && entry.version == version && entry.prior_character == prior_character && entry.string == string)
+		{
+			data.num_hits += 1;
+			data.entries.splice(data.entries.begin(), data.entries, it_entry);
+			return entry.width;
+		}
+
+		data.entries.erase(it_entry);
+		data.index.erase(it_index);
+	}
+
+	data.num_misses += 1;
+
+	const int width = font_engine_interface->GetStringWidth(handle, string, prior_character);
+
+	if (data.entries.size() >= max_num_entries)
+	{
+		const StringWidthEntry& oldest = data.entries.back();
+		data.index.erase(HashKey(oldest.handle, oldest.version, oldest.prior_character, oldest.string));
+		data.entries.pop_back();
+	}
+
+	data.entries.push_front(StringWidthEntry{ handle, version, prior_character, string, width });
+	data.index[hash] = data.entries.begin();
+
+	return width;
+}
+
+void StringWidthCache::GetStatistics(int& num_hits, int& num_misses)
+{
+	const StringWidthCacheData& data = GetData();
+	num_hits = data.num_hits;
+	num_misses = data.num_misses;
+}
+
+void StringWidthCache::Clear()
+{
+	StringWidthCacheData& data = GetData();
+	data.index.clear();
+	data.entries.clear();
+	data.num_hits = 0;
+	data.num_misses = 0;
+}
+
+} // namespace Rml
@@ -0,0 +1,60 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_STRINGWIDTHCACHE_H
+#define RMLUI_CORE_STRINGWIDTHCACHE_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+	A bounded, least-recently-used cache of string widths, used to avoid re-measuring the same words during text layout.
+
+	Entries are keyed by the font face handle and its version, the string, and the character preceding the string.
+ */
+
+class StringWidthCache
+{
+public:
+	/// Returns the width of the string when rendered with the given font face, measuring it only if it is not in the cache.
+	/// @param[in] handle The font face handle to measure with.
+	/// @param[in] string The string to measure.
+	/// @param[in] prior_character The character immediately preceding the string, for kerning.
+	/// @return The width of the string, in pixels.
+	static int GetStringWidth(FontFaceHandle handle, const String& string, Character prior_character = Character::Null);
+
+	/// Returns the number of cache hits and misses since the cache was last cleared.
+	static void GetStatistics(int& num_hits, int& num_misses);
+
+	/// Removes all entries and resets the statistics.
+	static void Clear();
+};
+
+} // namespace Rml
+#endif
@@ -0,0 +1,144 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "StyleMatchingPass.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "ElementDefinition.h"
+#include "ElementStyle.h"
+
+namespace Rml {
+
+// Parallel matching only pays off for large updates, such as after a media query change or a style sheet reload.
+static constexpr int elements_per_job = 128;
+static constexpr int min_jobs = 2;
+
+static StyleMatchingPass* active_pass = nullptr;
+
+StyleMatchingPass::StyleMatchingPass(Element* root)
+{
+	RMLUI_ASSERT(!active_pass);
+
+	CollectElements(root, false);
+
+	const int num_elements = (int)elements.size();
+	const int num_jobs = (num_elements + elements_per_job - 1) / elements_per_job;
+
+	if (num_jobs < min_jobs)
+		return;
+
+	RMLUI_ZoneScoped;
+
+	job_nodes.resize(num_jobs);
+	results.resize(num_elements);
+
+	// The element tree and style sheets are only read during the jobs, the calling thread is blocked until they are all done.
+	GetSystemInterface()->RunJobs(num_jobs, [this, num_elements](int job_index) {
+		StyleSheet::NodeList& nodes = job_nodes[job_index];
+		const int end = Math::Min((job_index + 1) * elements_per_job, num_elements);
+
+		for (int i = job_index * elements_per_job; i < end; i++)
+		{
+			const Element* element = elements[i];
+			MatchResult& result = results[i];
+			result.nodes_offset = (int)nodes.size();
+			result.structurally_volatile = false;
+
+			if (const StyleSheet* style_sheet = element->GetStyleSheet())
+				style_sheet->GetApplicableNodes(element, nodes, &result.structurally_volatile);
+
+			result.num_nodes = (int)nodes.size() - result.nodes_offset;
+		}
+	});
+
+	// Finally, look up the definitions in the style sheet caches, which are not safe to modify concurrently.
+	StyleSheet::NodeList applicable_nodes;
+	definitions.reserve(elements.size());
+
+	for (int i = 0; i < num_elements; i++)
+	{
+		const MatchResult& result = results[i];
+		const StyleSheet* style_sheet = elements[i]->GetStyleSheet();
+		if (result.structurally_volatile || !style_sheet)
+			continue;
+
+		const StyleSheet::NodeList& nodes = job_nodes[i / elements_per_job];
+		applicable_nodes.assign(nodes.begin() + result.nodes_offset, nodes.begin() + result.nodes_offset + result.num_nodes);
+
+		definitions[elements[i]] = style_sheet->GetElementDefinition(applicable_nodes);
+	}
+
+	valid = true;
+	active_pass = this;
+}
+
+StyleMatchingPass::~StyleMatchingPass()
+{
+	if (active_pass == this)
+		active_pass = nullptr;
+}
+
+bool StyleMatchingPass::GetMatchedDefinition(const Element* element, SharedPtr<ElementDefinition>& definition)
+{
+	if (!active_pass || !active_pass->valid)
+		return false;
+
+	auto it = active_pass->definitions.find(element);
+	if (it == active_pass->definitions.end())
+		return false;
+
+	definition = std::move(it->second);
+	active_pass->definitions.erase(it);
+	return true;
+}
+
+void StyleMatchingPass::Invalidate()
+{
+	if (active_pass)
+		active_pass->valid = false;
+}
+
+void StyleMatchingPass::CollectElements(Element* element, bool parent_definition_dirty)
+{
+	// A new definition for an element dirties the definitions of all its children during the update.
+	const bool definition_dirty = (parent_definition_dirty || element->GetStyle()->definition_dirty || element->structure_dirty);
+
+	if (definition_dirty)
+		elements.push_back(element);
+
+	if (definition_dirty || element->dirty_update_descendants)
+	{
+		const int num_children = element->GetNumChildren(true);
+		for (int i = 0; i < num_children; i++)
+			CollectElements(element->GetChild(i), definition_dirty);
+	}
+}
+
+} // namespace Rml
@@ -0,0 +1,89 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_STYLEMATCHINGPASS_H
+#define RMLUI_CORE_STYLEMATCHINGPASS_H
+
+#include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+class ElementDefinition;
+
+/**
+	Matches the style sheet selectors of many elements in parallel, ahead of the element update loop.
+
+	Before the update, the tree is searched for every element which is going to fetch a new definition. These elements
+	are split into jobs and matched against their style sheet on the jobs interface of the system interface. While the
+	pass is active, ElementStyle::UpdateDefinition() picks up the matched definition instead of matching the element
+	itself. Properties are still computed, and property changes applied, on the calling thread in the update loop.
+
+	Any change to the inputs of the selectors during the update, such as classes, pseudo classes, ids or the element
+	hierarchy, invalidates all matched definitions. Elements matching structurally volatile nodes are never
+	pre-matched, because structural selectors depend on the display property of their siblings.
+ */
+
+class StyleMatchingPass : NonCopyMoveable {
+public:
+	/// Matches the elements in the given subtree expected to update their definition, if there are enough of them to
+	/// warrant parallel matching. The matched definitions are made available until the pass is destroyed.
+	StyleMatchingPass(Element* root);
+	~StyleMatchingPass();
+
+	/// Retrieves the definition matched for the given element by the active pass.
+	/// @return True if the element was matched and the selector inputs have not changed since.
+	static bool GetMatchedDefinition(const Element* element, SharedPtr<ElementDefinition>& definition);
+
+	/// Invalidates all matched definitions of the active pass, called whenever any of the selector inputs change.
+	static void Invalidate();
+
+private:
+	void CollectElements(Element* element, bool parent_definition_dirty);
+
+	struct MatchResult {
+		int nodes_offset;
+		int num_nodes;
+		bool structurally_volatile;
+	};
+
+	// The elements to match, in tree order.
+	Vector<Element*> elements;
+
+	// The applicable nodes of every job, in the order of the job's elements.
+	Vector<StyleSheet::NodeList> job_nodes;
+	// The range of the job's nodes belonging to each element.
+	Vector<MatchResult> results;
+
+	UnorderedMap<const Element*, SharedPtr<ElementDefinition>> definitions;
+	bool valid = false;
+};
+
+} // namespace Rml
+#endif
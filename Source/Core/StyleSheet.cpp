@@ -328,18 +328,27 @@ size_t StyleSheet::NodeHash(const String& tag, const String& id)
 }
 
 // Returns the compiled element definition for a given element hierarchy.
-SharedPtr<ElementDefinition> StyleSheet::GetElementDefinition(const Element* element) const
+SharedPtr<ElementDefinition> StyleSheet::GetElementDefinition(const Element* element, bool* structurally_volatile) const
 {
 	RMLUI_ASSERT_NONRECURSIVE;
 
 	// See if there are any styles defined for this element.
 	// Using static to avoid allocations. Make sure we don't call this function recursively.
-	static Vector< const StyleSheetNode* > applicable_nodes;
+	static NodeList applicable_nodes;
 	applicable_nodes.clear();
 
+	GetApplicableNodes(element, applicable_nodes, structurally_volatile);
+
+	return GetElementDefinition(applicable_nodes);
+}
+
+void StyleSheet::GetApplicableNodes(const Element* element, NodeList& applicable_nodes, bool* structurally_volatile) const
+{
 	const String& tag = element->GetTagName();
 	const String& id = element->GetId();
 
+	const size_t first_node = applicable_nodes.size();
+
 	// The styled_node_index is hashed with the tag and id of the RCSS rule. However, we must also check
 	// the rules which don't have them defined, because they apply regardless of tag and id.
 	Array<size_t, 4> node_hash;
@@ -356,6 +365,9 @@ SharedPtr<ElementDefinition> StyleSheet::GetElementDefinition(const Element* ele
 		node_hash[3] = NodeHash(tag, id);
 	}
 
+	// Shared between all nodes tested against this element, so that the element's ancestors are only visited once.
+	AncestorFilter ancestor_filter(element);
+
 	// The hashes are keys into a set of applicable nodes (given tag and id).
 	for (int i = 0; i < num_hashes; i++)
 	{
@@ -369,7 +381,10 @@ SharedPtr<ElementDefinition> StyleSheet::GetElementDefinition(const Element* ele
 			// trying to match nodes in the element's hierarchy to nodes in the style hierarchy.
 			for (const StyleSheetNode* node : nodes)
 			{
-				if (node->IsApplicable(element, true))
+				if (structurally_volatile && node->IsStructurallyVolatileFor(element))
+					*structurally_volatile = true;
+
+				if (node->IsApplicable(element, true, &ancestor_filter))
 				{
 					applicable_nodes.push_back(node);
 				}
@@ -377,8 +392,11 @@ SharedPtr<ElementDefinition> StyleSheet::GetElementDefinition(const Element* ele
 		}
 	}
 
-	std::sort(applicable_nodes.begin(), applicable_nodes.end(), StyleSheetNodeSort);
+	std::sort(applicable_nodes.begin() + first_node, applicable_nodes.end(), StyleSheetNodeSort);
+}
 
+SharedPtr<ElementDefinition> StyleSheet::GetElementDefinition(const NodeList& applicable_nodes) const
+{
 	// If this element definition won't actually store any information, don't bother with it.
 	if (applicable_nodes.empty())
 		return nullptr;
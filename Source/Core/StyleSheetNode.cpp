@@ -29,12 +29,91 @@
 #include "StyleSheetNode.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include "ElementStyle.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetNodeSelector.h"
+#include "Utilities.h"
 #include <algorithm>
 
 namespace Rml {
 
+AncestorFilter::AncestorFilter(const Element* element) : element(element)
+{}
+
+bool AncestorFilter::MayContainAll(const Vector< size_t >& hashes)
+{
+	if (hashes.empty())
+		return true;
+
+	if (!built)
+		Build();
+
+	for (size_t hash : hashes)
+	{
+		if (!MayContain(hash))
+			return false;
+	}
+
+	return true;
+}
+
+size_t AncestorFilter::HashTag(const String& tag)
+{
+	size_t seed = 't';
+	Utilities::HashCombine(seed, tag);
+	return seed;
+}
+
+size_t AncestorFilter::HashId(const String& id)
+{
+	size_t seed = 'i';
+	Utilities::HashCombine(seed, id);
+	return seed;
+}
+
+size_t AncestorFilter::HashClass(const String& class_name)
+{
+	size_t seed = 'c';
+	Utilities::HashCombine(seed, class_name);
+	return seed;
+}
+
+void AncestorFilter::Build()
+{
+	RMLUI_ZoneScoped;
+
+	built = true;
+
+	for (const Element* ancestor = element->GetParentNode(); ancestor; ancestor = ancestor->GetParentNode())
+	{
+		Insert(HashTag(ancestor->GetTagName()));
+
+		const String& id = ancestor->GetId();
+		if (!id.empty())
+			Insert(HashId(id));
+
+		for (const String& class_name : ancestor->GetStyle()->GetClassNameList())
+			Insert(HashClass(class_name));
+	}
+}
+
+// Each hash sets two bits in the filter.
+void AncestorFilter::Insert(size_t hash)
+{
+	const size_t bit_a = hash % num_bits;
+	const size_t bit_b = (hash / num_bits) % num_bits;
+	bits[bit_a / 64] |= (uint64_t(1) << (bit_a % 64));
+	bits[bit_b / 64] |= (uint64_t(1) << (bit_b % 64));
+}
+
+bool AncestorFilter::MayContain(size_t hash) const
+{
+	const size_t bit_a = hash % num_bits;
+	const size_t bit_b = (hash / num_bits) % num_bits;
+	return (bits[bit_a / 64] & (uint64_t(1) << (bit_a % 64))) && (bits[bit_b / 64] & (uint64_t(1) << (bit_b % 64)));
+}
+
+
 StyleSheetNode::StyleSheetNode()
 {
 	CalculateAndSetSpecificity();
@@ -44,12 +123,14 @@ StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, const String& tag, const
 	: parent(parent), tag(tag), id(id), class_names(classes), pseudo_class_names(pseudo_classes), structural_selectors(structural_selectors), child_combinator(child_combinator)
 {
 	CalculateAndSetSpecificity();
+	CalculateAncestorHashes();
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, String&& tag, String&& id, StringList&& classes, StringList&& pseudo_classes, StructuralSelectorList&& structural_selectors, bool child_combinator)
 	: parent(parent), tag(std::move(tag)), id(std::move(id)), class_names(std::move(classes)), pseudo_class_names(std::move(pseudo_classes)), structural_selectors(std::move(structural_selectors)), child_combinator(child_combinator)
 {
 	CalculateAndSetSpecificity();
+	CalculateAncestorHashes();
 }
 
 StyleSheetNode* StyleSheetNode::GetOrCreateChildNode(const StyleSheetNode& other)
@@ -288,7 +369,7 @@ inline bool StyleSheetNode::MatchStructuralSelector(const Element* element) cons
 }
 
 // Returns true if this node is applicable to the given element, given its IDs, classes and heritage.
-bool StyleSheetNode::IsApplicable(const Element* const in_element, bool skip_id_tag) const
+bool StyleSheetNode::IsApplicable(const Element* const in_element, bool skip_id_tag, AncestorFilter* ancestor_filter) const
 {
 	// Determine whether the element matches the current node and its entire lineage. The entire hierarchy of
 	// the element's document will be considered during the match as necessary.
@@ -306,6 +387,10 @@ bool StyleSheetNode::IsApplicable(const Element* const in_element, bool skip_id_
 			return false;
 	}
 
+	// Reject the node early if the requirements of our parent nodes can not be met by any ancestor.
+	if (ancestor_filter && !ancestor_filter->MayContainAll(ancestor_hashes))
+		return false;
+
 	const Element* element = in_element;
 
 	// Walk up through all our parent nodes, each one of them must be matched by some ancestor element.
@@ -338,6 +423,11 @@ bool StyleSheetNode::IsStructurallyVolatile() const
 	return is_structurally_volatile;
 }
 
+bool StyleSheetNode::IsStructurallyVolatileFor(const Element* element) const
+{
+	return is_structurally_volatile && MatchClassPseudoClass(element);
+}
+
 
 void StyleSheetNode::CalculateAndSetSpecificity()
 {
@@ -360,4 +450,20 @@ void StyleSheetNode::CalculateAndSetSpecificity()
 		specificity += parent->specificity;
 }
 
+void StyleSheetNode::CalculateAncestorHashes()
+{
+	// The root node has no requirements.
+	if (!parent || !parent->parent)
+		return;
+
+	ancestor_hashes = parent->ancestor_hashes;
+
+	if (!parent->tag.empty())
+		ancestor_hashes.push_back(AncestorFilter::HashTag(parent->tag));
+	if (!parent->id.empty())
+		ancestor_hashes.push_back(AncestorFilter::HashId(parent->id));
+	for (const String& class_name : parent->class_names)
+		ancestor_hashes.push_back(AncestorFilter::HashClass(class_name));
+}
+
 } // namespace Rml
@@ -51,6 +51,37 @@ using StructuralSelectorList = Vector< StructuralSelector >;
 using StyleSheetNodeList = Vector< UniquePtr<StyleSheetNode> >;
 
 
+/**
+	A bloom filter of the tags, ids and classes of an element's ancestors. Used to quickly reject style sheet nodes whose
+	ancestor requirements can not be met, without walking up the element tree for every node. The filter is built on
+	first use, so that elements not tested against any descendant selectors don't pay for it.
+ */
+
+class AncestorFilter
+{
+public:
+	AncestorFilter(const Element* element);
+
+	/// Returns false if any of the given hashes definitely isn't found among the element's ancestors, otherwise true.
+	bool MayContainAll(const Vector< size_t >& hashes);
+
+	static size_t HashTag(const String& tag);
+	static size_t HashId(const String& id);
+	static size_t HashClass(const String& class_name);
+
+private:
+	void Build();
+	void Insert(size_t hash);
+	bool MayContain(size_t hash) const;
+
+	static constexpr size_t num_bits = 512;
+
+	const Element* element;
+	bool built = false;
+	uint64_t bits[num_bits / 64] = {};
+};
+
+
 /**
 	A style sheet is composed of a tree of nodes.
 
@@ -90,7 +121,8 @@ public:
 	const PropertyDictionary& GetProperties() const;
 
 	/// Returns true if this node is applicable to the given element, given its IDs, classes and heritage.
-	bool IsApplicable(const Element* element, bool skip_id_tag) const;
+	/// @param[in] ancestor_filter If set, used to reject the node before walking the ancestors of the element.
+	bool IsApplicable(const Element* element, bool skip_id_tag, AncestorFilter* ancestor_filter = nullptr) const;
 
 	/// Returns the specificity of this node.
 	int GetSpecificity() const;
@@ -98,12 +130,17 @@ public:
 	/// sensitive to sibling changes. 
 	/// @warning Result is only valid if structural volatility is set since any changes to the node tree.
 	bool IsStructurallyVolatile() const;
+	/// Returns true if this node is structurally volatile, and its class and pseudo class requirements are met by the
+	/// given element. That is, whether the node may start or stop applying to the element when its siblings change.
+	bool IsStructurallyVolatileFor(const Element* element) const;
 
 private:
 	// Returns true if the requirements of this node equals the given arguments.
 	bool EqualRequirements(const String& tag, const String& id, const StringList& classes, const StringList& pseudo_classes, const StructuralSelectorList& structural_pseudo_classes, bool child_combinator) const;
 
 	void CalculateAndSetSpecificity();
+	// Builds the list of ancestor filter hashes from the requirements of our parent nodes.
+	void CalculateAncestorHashes();
 
 	// Match an element to the local node requirements.
 	inline bool Match(const Element* element) const;
@@ -121,6 +158,9 @@ private:
 	StructuralSelectorList structural_selectors; // Represents structural pseudo classes
 	bool child_combinator = false; // The '>' combinator: This node only matches if the element is a parent of the previous matching element.
 
+	// Hashes of the tags, ids, and classes required by our parent nodes, to be tested against the ancestor filter.
+	Vector< size_t > ancestor_hashes;
+
 	// True if any ancestor, descendent, or self is a structural pseudo class.
 	bool is_structurally_volatile = true;
 
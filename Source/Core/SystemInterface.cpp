@@ -28,9 +28,13 @@
 
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/StringUtilities.h"
 #include "../../Include/RmlUi/Core/URL.h"
 
+#include <atomic>
+#include <thread>
+
 #ifdef RMLUI_PLATFORM_WIN32
 #include <windows.h>
 #endif
@@ -140,4 +144,25 @@ void SystemInterface::DeactivateKeyboard()
 {
 }
 
+void SystemInterface::RunJobs(int num_jobs, const Function<void(int)>& job)
+{
+	const int num_threads = Math::Min(num_jobs, (int)std::thread::hardware_concurrency());
+
+	std::atomic<int> next_job(0);
+	auto run_jobs = [&]() {
+		for (int i = next_job++; i < num_jobs; i = next_job++)
+			job(i);
+	};
+
+	// The calling thread takes part in running the jobs.
+	Vector<std::thread> threads;
+	for (int i = 1; i < num_threads; i++)
+		threads.emplace_back(run_jobs);
+
+	run_jobs();
+
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
 } // namespace Rml
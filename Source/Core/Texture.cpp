@@ -72,6 +72,22 @@ Vector2i Texture::GetDimensions(RenderInterface* render_interface) const
 	return resource->GetDimensions(render_interface);
 }
 
+bool Texture::IsLoading(RenderInterface* render_interface) const
+{
+	if (!resource)
+		return false;
+
+	return resource->IsLoading(render_interface);
+}
+
+bool Texture::Update(const byte* source, Vector2i source_dimensions, Vector2i offset) const
+{
+	if (!resource)
+		return false;
+
+	return resource->Update(source, source_dimensions, offset);
+}
+
 bool Texture::operator==(const Texture& other) const
 {
 	return resource == other.resource;
@@ -29,13 +29,146 @@
 #include "TextureDatabase.h"
 #include "TextureResource.h"
 #include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/StringUtilities.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <thread>
 
 namespace Rml {
 
 static TextureDatabase* texture_database = nullptr;
 
+/*
+	Decodes file textures on a background thread. The decoded data is handed back to the texture resources on the main
+	thread. File textures are never removed from the database, thus the raw resource pointers stay valid.
+*/
+class AsyncTextureLoader : NonCopyMoveable {
+public:
+	AsyncTextureLoader() : thread(&AsyncTextureLoader::Run, this) {}
+
+	~AsyncTextureLoader()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stop = true;
+		}
+		condition.notify_all();
+		thread.join();
+	}
+
+	void Enqueue(TextureResource* texture, RenderInterface* render_interface)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			pending.push_back(Request{ texture, render_interface, texture->GetSource(), nullptr, Vector2i(0, 0) });
+		}
+		condition.notify_all();
+	}
+
+	// Removes all requests for the render interface, waiting for any request in progress to finish.
+	void Cancel(RenderInterface* render_interface)
+	{
+		Vector<Request> cancelled;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			condition.wait(lock, [&] { return active_render_interface != render_interface; });
+
+			auto move_cancelled = [&](std::deque<Request>& requests) {
+				auto it = std::stable_partition(requests.begin(), requests.end(), [&](const Request& request) { return request.render_interface != render_interface; });
+				std::move(it, requests.end(), std::back_inserter(cancelled));
+				requests.erase(it, requests.end());
+			};
+			move_cancelled(pending);
+			move_cancelled(finished);
+		}
+
+		for (Request& request : cancelled)
+			request.texture->CancelAsyncLoad(render_interface);
+	}
+
+	int Upload(RenderInterface* render_interface, double budget)
+	{
+		const double deadline = (budget > 0 ? GetSystemInterface()->GetElapsedTime() + budget : 0.0);
+		int num_uploaded = 0;
+
+		while (true)
+		{
+			Request request;
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				auto it = std::find_if(finished.begin(), finished.end(), [&](const Request& request) { return request.render_interface == render_interface; });
+				if (it == finished.end())
+					break;
+
+				request = std::move(*it);
+				finished.erase(it);
+			}
+
+			if (request.texture->FinishAsyncLoad(render_interface, request.data.get(), request.dimensions))
+				num_uploaded += 1;
+
+			if (deadline > 0 && GetSystemInterface()->GetElapsedTime() >= deadline)
+				break;
+		}
+
+		return num_uploaded;
+	}
+
+private:
+	struct Request {
+		TextureResource* texture;
+		RenderInterface* render_interface;
+		String source;
+		UniquePtr<byte[]> data;
+		Vector2i dimensions;
+	};
+
+	void Run()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		while (true)
+		{
+			condition.wait(lock, [this] { return stop || !pending.empty(); });
+			if (stop)
+				return;
+
+			Request request = std::move(pending.front());
+			pending.pop_front();
+			active_render_interface = request.render_interface;
+
+			lock.unlock();
+			{
+				RMLUI_ZoneScopedN("DecodeTexture");
+				if (!request.render_interface->DecodeTexture(request.data, request.dimensions, request.source))
+					request.data.reset();
+			}
+			lock.lock();
+
+			active_render_interface = nullptr;
+			finished.push_back(std::move(request));
+			condition.notify_all();
+		}
+	}
+
+	std::mutex mutex;
+	// Signalled when requests are added, when a request is finished, and when stopping.
+	std::condition_variable condition;
+
+	std::deque<Request> pending;
+	std::deque<Request> finished;
+	RenderInterface* active_render_interface = nullptr;
+	bool stop = false;
+
+	std::thread thread;
+};
+
 TextureDatabase::TextureDatabase()
 {
 	RMLUI_ASSERT(texture_database == nullptr);
@@ -126,6 +259,71 @@ StringList TextureDatabase::GetSourceList()
 	return result;
 }
 
+void TextureDatabase::EnableAsyncLoading(RenderInterface* render_interface, bool enable)
+{
+	if (!texture_database || !render_interface)
+		return;
+
+	auto& async_render_interfaces = texture_database->async_render_interfaces;
+	if (enable)
+	{
+		async_render_interfaces[render_interface] += 1;
+		if (!texture_database->async_loader)
+			texture_database->async_loader = MakeUnique<AsyncTextureLoader>();
+	}
+	else
+	{
+		auto it = async_render_interfaces.find(render_interface);
+		if (it == async_render_interfaces.end())
+			return;
+
+		if (--it->second == 0)
+		{
+			async_render_interfaces.erase(it);
+			texture_database->async_loader->Cancel(render_interface);
+			texture_database->async_load_generations[render_interface] += 1;
+		}
+	}
+}
+
+bool TextureDatabase::IsAsyncLoading(RenderInterface* render_interface)
+{
+	if (!texture_database)
+		return false;
+
+	const auto& async_render_interfaces = texture_database->async_render_interfaces;
+	return async_render_interfaces.find(render_interface) != async_render_interfaces.end();
+}
+
+void TextureDatabase::RequestAsyncLoad(TextureResource* texture, RenderInterface* render_interface)
+{
+	RMLUI_ASSERT(IsAsyncLoading(render_interface));
+	texture_database->async_loader->Enqueue(texture, render_interface);
+}
+
+unsigned int TextureDatabase::GetAsyncLoadGeneration(RenderInterface* render_interface)
+{
+	if (!texture_database)
+		return 0;
+
+	const auto& async_load_generations = texture_database->async_load_generations;
+	auto it = async_load_generations.find(render_interface);
+	return (it == async_load_generations.end() ? 0 : it->second);
+}
+
+int TextureDatabase::UploadAsyncTextures(RenderInterface* render_interface, double budget)
+{
+	if (!IsAsyncLoading(render_interface))
+		return 0;
+
+	RMLUI_ZoneScoped;
+	const int num_uploaded = texture_database->async_loader->Upload(render_interface, budget);
+	if (num_uploaded > 0)
+		texture_database->async_load_generations[render_interface] += 1;
+
+	return num_uploaded;
+}
+
 void TextureDatabase::ReleaseTextures(RenderInterface* render_interface)
 {
 	if (texture_database)
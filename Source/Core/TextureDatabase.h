@@ -33,6 +33,7 @@
 
 namespace Rml {
 
+class AsyncTextureLoader;
 class RenderInterface;
 class TextureResource;
 
@@ -64,6 +65,22 @@ public:
 	/// Return a list of all texture sources currently in the database.
 	static StringList GetSourceList();
 
+	/// Enables or disables asynchronous loading of file textures through a render interface. Calls are reference counted,
+	/// so that the textures are loaded asynchronously as long as any context using the render interface has it enabled.
+	/// Pending loads are cancelled once disabled, their textures are loaded synchronously when next accessed.
+	static void EnableAsyncLoading(RenderInterface* render_interface, bool enable);
+	/// Returns true if file textures are loaded asynchronously through the render interface.
+	static bool IsAsyncLoading(RenderInterface* render_interface);
+	/// Queues a file texture to be decoded on the background thread.
+	static void RequestAsyncLoad(TextureResource* texture, RenderInterface* render_interface);
+	/// Returns a number which changes whenever textures of the render interface are generated or their loads cancelled.
+	static unsigned int GetAsyncLoadGeneration(RenderInterface* render_interface);
+	/// Generates the textures decoded for a render interface, until the budget is exceeded. At least one texture is
+	/// generated if any are decoded.
+	/// @param[in] budget The time budget in seconds, or zero to generate all decoded textures.
+	/// @return The number of textures generated.
+	static int UploadAsyncTextures(RenderInterface* render_interface, double budget);
+
 private:
 	TextureDatabase();
 	~TextureDatabase();
@@ -73,6 +90,13 @@ private:
 
     using CallbackTextureMap = UnorderedSet< TextureResource* >;
     CallbackTextureMap callback_textures;
+
+	// Reference count of contexts with asynchronous loading enabled, for each render interface.
+	SmallUnorderedMap< RenderInterface*, int > async_render_interfaces;
+	// Incremented whenever loads finish or are cancelled, kept after asynchronous loading is disabled.
+	SmallUnorderedMap< RenderInterface*, unsigned int > async_load_generations;
+	// Created on first use. Declared last so that its thread is stopped before the textures are destroyed.
+	UniquePtr< AsyncTextureLoader > async_loader;
 };
 
 } // namespace Rml
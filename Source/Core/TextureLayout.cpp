@@ -35,9 +35,9 @@ namespace Rml {
 
 struct RectangleSort
 {
-	bool operator()(const TextureLayoutRectangle& lhs, const TextureLayoutRectangle& rhs) const
+	bool operator()(const UniquePtr<TextureLayoutRectangle>& lhs, const UniquePtr<TextureLayoutRectangle>& rhs) const
 	{
-		return lhs.GetDimensions().y > rhs.GetDimensions().y;
+		return lhs->GetDimensions().y > rhs->GetDimensions().y;
 	}
 };
 
@@ -52,7 +52,7 @@ TextureLayout::~TextureLayout()
 // Adds a rectangle to the list of rectangles to be laid out.
 void TextureLayout::AddRectangle(int id, Vector2i dimensions)
 {
-	rectangles.push_back(TextureLayoutRectangle(id, dimensions));
+	rectangles.push_back(MakeUnique<TextureLayoutRectangle>(id, dimensions));
 }
 
 // Returns one of the layout's rectangles.
@@ -61,7 +61,7 @@ TextureLayoutRectangle& TextureLayout::GetRectangle(int index)
 	RMLUI_ASSERT(index >= 0);
 	RMLUI_ASSERT(index < GetNumRectangles());
 
-	return rectangles[index];
+	return *rectangles[index];
 }
 
 // Returns the number of rectangles in the layout.
@@ -106,4 +106,21 @@ bool TextureLayout::GenerateLayout(int max_texture_dimensions)
 	return true;
 }
 
+// Adds a rectangle to an already generated layout.
+int TextureLayout::InsertRectangle(int id, Vector2i dimensions)
+{
+	auto rectangle = MakeUnique<TextureLayoutRectangle>(id, dimensions);
+
+	for (int i = 0; i < GetNumTextures(); i++)
+	{
+		if (textures[i].Insert(*rectangle, i))
+		{
+			rectangles.push_back(std::move(rectangle));
+			return GetNumRectangles() - 1;
+		}
+	}
+
+	return -1;
+}
+
 } // namespace Rml
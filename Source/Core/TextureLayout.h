@@ -47,6 +47,9 @@ public:
 	TextureLayout();
 	~TextureLayout();
 
+	TextureLayout(TextureLayout&&) = default;
+	TextureLayout& operator=(TextureLayout&&) = default;
+
 	/// Adds a rectangle to the list of rectangles to be laid out. All rectangles must be added to
 	/// the layout before the layout is generated.
 	/// @param[in] id The id of the rectangle; used to identify the rectangle after it has been positioned.
@@ -74,8 +77,16 @@ public:
 	/// @return True if the layout was generated successfully, false if not.
 	bool GenerateLayout(int max_texture_dimensions);
 
+	/// Adds a rectangle to an already generated layout, placing it in the free space of the existing textures.
+	/// Previously placed rectangles keep their position, and the textures keep their dimensions.
+	/// @param[in] id The id of the rectangle; used to identify the rectangle after it has been positioned.
+	/// @param[in] dimensions The dimensions of the rectangle.
+	/// @return The index of the placed rectangle, or -1 if there was no room for it.
+	int InsertRectangle(int id, Vector2i dimensions);
+
 private:
-	using RectangleList = Vector< TextureLayoutRectangle >;
+	// Rectangles are referenced by the rows of the textures, so they must stay in place when inserting new ones.
+	using RectangleList = Vector< UniquePtr<TextureLayoutRectangle> >;
 	using TextureList = Vector< TextureLayoutTexture >;
 
 	TextureList textures;
@@ -31,8 +31,10 @@
 
 namespace Rml {
 
-TextureLayoutRow::TextureLayoutRow()
+TextureLayoutRow::TextureLayoutRow(int _y)
 {
+	y = _y;
+	width = 1;
 	height = 0;
 }
 
@@ -41,9 +43,10 @@ TextureLayoutRow::~TextureLayoutRow()
 }
 
 // Attempts to position unplaced rectangles from the layout into this row.
-int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
+int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int _y)
 {
-	int width = 1;
+	y = _y;
+	width = 1;
 	int first_unplaced_index = 0;
 	int placed_rectangles = 0;
 
@@ -85,6 +88,24 @@ int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
 	return placed_rectangles;
 }
 
+// Attempts to place a single rectangle at the end of this row.
+bool TextureLayoutRow::Insert(TextureLayoutRectangle& rectangle, int texture_index, int max_width)
+{
+	if (rectangles.empty())
+		height = Math::Max(height, rectangle.GetDimensions().y);
+
+	if (rectangle.GetDimensions().y > height || width + rectangle.GetDimensions().x + 1 > max_width)
+		return false;
+
+	rectangles.push_back(&rectangle);
+	rectangle.Place(texture_index, Vector2i(width, y));
+
+	if (rectangle.GetDimensions().x > 0)
+		width += rectangle.GetDimensions().x + 1;
+
+	return true;
+}
+
 // Assigns allocated texture data to all rectangles in this row.
 void TextureLayoutRow::Allocate(byte* texture_data, int stride)
 {
@@ -44,7 +44,9 @@ class TextureLayout;
 class TextureLayoutRow
 {
 public:
-	TextureLayoutRow();
+	/// Constructs an empty row.
+	/// @param[in] y The y-coordinate of this row, only used when inserting rectangles into an empty row.
+	TextureLayoutRow(int y = 0);
 	~TextureLayoutRow();
 
 	/// Attempts to position unplaced rectangles from the layout into this row.
@@ -54,6 +56,14 @@ public:
 	/// @return The number of placed rectangles.
 	int Generate(TextureLayout& layout, int width, int y);
 
+	/// Attempts to place a single rectangle at the end of this row, without moving any placed rectangles. An empty row
+	/// takes the height of the first inserted rectangle.
+	/// @param[in] rectangle The rectangle to place.
+	/// @param[in] texture_index The index of the texture containing this row.
+	/// @param[in] max_width The maximum width of this row.
+	/// @return True if the rectangle was placed, false if it did not fit.
+	bool Insert(TextureLayoutRectangle& rectangle, int texture_index, int max_width);
+
 	/// Assigns allocated texture data to all rectangles in this row.
 	/// @param[in] texture_data The pointer to the beginning of the texture's data.
 	/// @param[in] stride The stride of the texture's surface, in bytes;
@@ -69,6 +79,8 @@ public:
 private:
 	using RectangleList = Vector< TextureLayoutRectangle* >;
 
+	int y;
+	int width;
 	int height;
 	RectangleList rectangles;
 };
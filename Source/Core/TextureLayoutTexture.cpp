@@ -32,7 +32,7 @@
 
 namespace Rml {
 
-TextureLayoutTexture::TextureLayoutTexture() : dimensions(0, 0)
+TextureLayoutTexture::TextureLayoutTexture() : dimensions(0, 0), rows_height(1)
 {}
 
 TextureLayoutTexture::~TextureLayoutTexture()
@@ -111,7 +111,10 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 
 		// If the rectangles were successfully laid out within the texture limits, we're done.
 		if (success)
+		{
+			rows_height = height;
 			return num_placed_rectangles;
+		}
 
 		// Couldn't do it! Increase the texture size, clear the rectangles and try again - unless
 		// we've hit the maximum texture size, in which case return true if we've placed any
@@ -121,7 +124,10 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 		else
 		{
 			if (dimensions.y << 1 > maximum_dimensions)
+			{
+				rows_height = height;
 				return num_placed_rectangles;
+			}
 
 			dimensions.y <<= 1;
 		}
@@ -135,6 +141,30 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 	}
 }
 
+// Attempts to place a single rectangle in the free space of this texture.
+bool TextureLayoutTexture::Insert(TextureLayoutRectangle& rectangle, int texture_index)
+{
+	for (TextureLayoutRow& row : rows)
+	{
+		if (row.Insert(rectangle, texture_index, dimensions.x))
+			return true;
+	}
+
+	// Start a new row below the existing ones.
+	const int new_rows_height = rows_height + rectangle.GetDimensions().y + 1;
+	if (new_rows_height > dimensions.y)
+		return false;
+
+	TextureLayoutRow row(rows_height);
+	if (!row.Insert(rectangle, texture_index, dimensions.x))
+		return false;
+
+	rows.push_back(row);
+	rows_height = new_rows_height;
+
+	return true;
+}
+
 // Allocates the texture.
 UniquePtr<byte[]> TextureLayoutTexture::AllocateTexture()
 {
@@ -61,6 +61,13 @@ public:
 	/// @return The number of placed rectangles.
 	int Generate(TextureLayout& layout, int maximum_dimensions);
 
+	/// Attempts to place a single rectangle in the free space of this texture, without moving any placed rectangles
+	/// or resizing the texture. The rectangle is added to the first row with room for it, or to a new row below.
+	/// @param[in] rectangle The rectangle to place.
+	/// @param[in] texture_index The index of this texture within its layout.
+	/// @return True if the rectangle was placed, false if it did not fit.
+	bool Insert(TextureLayoutRectangle& rectangle, int texture_index);
+
 	/// Allocates the texture.
 	/// @return The allocated texture data.
 	UniquePtr<byte[]> AllocateTexture();
@@ -69,6 +76,8 @@ private:
 	using RowList = Vector< TextureLayoutRow >;
 
 	Vector2i dimensions;
+	// The height used by the rows, including padding.
+	int rows_height;
 	RowList rows;
 };
 
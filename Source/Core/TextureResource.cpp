@@ -102,6 +102,61 @@ const String& TextureResource::GetSource() const
 	return source;
 }
 
+bool TextureResource::IsLoading(RenderInterface* render_interface) const
+{
+	return async_loads.find(render_interface) != async_loads.end();
+}
+
+bool TextureResource::FinishAsyncLoad(RenderInterface* render_interface, const byte* data, Vector2i dimensions)
+{
+	if (async_loads.erase(render_interface) == 0)
+		return false;
+
+	RMLUI_ZoneScoped;
+
+	TextureHandle handle = 0;
+	bool success = false;
+
+	// Fall back to loading the texture through the render interface if it could not be decoded.
+	if (data)
+		success = render_interface->GenerateTexture(handle, data, dimensions);
+	else
+		success = render_interface->LoadTexture(handle, dimensions, source);
+
+	if (success)
+	{
+		texture_data[render_interface] = TextureData(handle, dimensions);
+	}
+	else
+	{
+		Log::Message(Log::LT_WARNING, "Failed to load texture from %s.", source.c_str());
+		texture_data[render_interface] = TextureData(0, Vector2i(0, 0));
+	}
+
+	return true;
+}
+
+void TextureResource::CancelAsyncLoad(RenderInterface* render_interface)
+{
+	if (async_loads.erase(render_interface) != 0)
+		texture_data.erase(render_interface);
+}
+
+// Updates a region of the texture for all render interfaces it has been loaded by.
+bool TextureResource::Update(const byte* source, Vector2i source_dimensions, Vector2i offset)
+{
+	bool result = true;
+
+	for (auto& interface_data_pair : texture_data)
+	{
+		TextureHandle handle = interface_data_pair.second.first;
+		if (handle && !interface_data_pair.first->UpdateTexture(handle, source, source_dimensions, offset))
+			result = false;
+	}
+
+	return result;
+}
+
 // Releases the texture's handle.
 void TextureResource::Release(RenderInterface* render_interface)
 {
@@ -115,6 +170,7 @@ void TextureResource::Release(RenderInterface* render_interface)
 		}
 
 		texture_data.clear();
+		async_loads.clear();
 	}
 	else
 	{
@@ -127,6 +183,7 @@ void TextureResource::Release(RenderInterface* render_interface)
 			texture_iterator->first->ReleaseTexture(handle);
 
 		texture_data.erase(render_interface);
+		async_loads.erase(render_interface);
 	}
 }
 
@@ -166,6 +223,16 @@ bool TextureResource::Load(RenderInterface* render_interface)
 		return success;
 	}
 
+	// Decode the texture on a background thread if enabled for the render interface, it is generated once decoded.
+	if (TextureDatabase::IsAsyncLoading(render_interface))
+	{
+		texture_data[render_interface] = TextureData(0, Vector2i(0, 0));
+		async_loads.insert(render_interface);
+		TextureDatabase::RequestAsyncLoad(this, render_interface);
+
+		return true;
+	}
+
 	// No callback function, load the texture through the render interface.
 	TextureHandle handle;
 	Vector2i dimensions;
@@ -63,6 +63,19 @@ public:
 	/// Returns the resource's source.
 	const String& GetSource() const;
 
+	/// Returns true while the texture is being loaded asynchronously for the given render interface.
+	bool IsLoading(RenderInterface* render_interface) const;
+	/// Generates the texture from data decoded on the background thread, if it is still being loaded.
+	/// @param[in] data The decoded texture data, or nullptr to load the texture synchronously instead.
+	/// @return True if the texture was still being loaded.
+	bool FinishAsyncLoad(RenderInterface* render_interface, const byte* data, Vector2i dimensions);
+	/// Stops waiting for an asynchronous load, the texture is loaded synchronously when next accessed.
+	void CancelAsyncLoad(RenderInterface* render_interface);
+
+	/// Updates a region of the texture for all render interfaces it has been loaded by.
+	/// @return False if any render interface could not update its texture.
+	bool Update(const byte* source, Vector2i source_dimensions, Vector2i offset);
+
 	/// Releases the texture's handle.
 	void Release(RenderInterface* render_interface = nullptr);
 
@@ -79,6 +92,9 @@ private:
 	TextureDataMap texture_data;
 
 	UniquePtr<TextureCallback> texture_callback;
+
+	// Render interfaces for which the texture is being loaded asynchronously, their texture data is empty until then.
+	SmallUnorderedSet<RenderInterface*> async_loads;
 };
 
 } // namespace Rml
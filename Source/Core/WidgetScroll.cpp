@@ -164,6 +164,9 @@ void WidgetScroll::Update()
 			}
 		}
 	}
+
+	if (arrow_timers[0] > 0 || arrow_timers[1] > 0)
+		DirtyScrolledElement();
 }
 
 // Sets the position of the bar.
@@ -442,6 +445,9 @@ void WidgetScroll::ProcessEvent(Event& event)
 			last_update_time = Clock::GetElapsedTime();
 			SetBarPosition(OnLineIncrement());
 		}
+
+		if (arrow_timers[0] > 0 || arrow_timers[1] > 0)
+			DirtyScrolledElement();
 	}
 	else if (event == EventId::Mouseup ||
 			 event == EventId::Mouseout)
@@ -453,6 +459,12 @@ void WidgetScroll::ProcessEvent(Event& event)
 	}
 }
 
+void WidgetScroll::DirtyScrolledElement()
+{
+	if (Element* scrolled_element = parent->GetParentNode())
+		scrolled_element->DirtyUpdate();
+}
+
 void WidgetScroll::PositionBar()
 {
 	const Vector2f track_dimensions = track->GetBox().GetSize();
@@ -113,6 +113,9 @@ private:
 	// Set the offset on 'bar' from its position.
 	void PositionBar();
 
+	// Marks the element owning the scrollbar for update, so that the key repeats keep running.
+	void DirtyScrolledElement();
+
 	/// Called when the slider is incremented by one 'line', either by the down / right key or a mouse-click on the
 	/// increment arrow.
 	/// @return The new position of the bar.
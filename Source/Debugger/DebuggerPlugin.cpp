@@ -164,6 +164,12 @@ bool DebuggerPlugin::IsVisible()
 // Renders any debug elements in the debug context.
 void DebuggerPlugin::Render()
 {
+	Geometry::BeginFrame();
+
+	// The debug overlays follow the hovered and selected elements, which may change at any time.
+	if (host_context && (render_outlines || (info_element && info_element->IsVisible())))
+		host_context->DirtyDamageRegion();
+
 	// Render the outlines of the debug context's elements.
 	if (render_outlines && debug_context)
 	{
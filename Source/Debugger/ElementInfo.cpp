@@ -118,6 +118,9 @@ void ElementInfo::OnUpdate()
 		UpdateTitle();
 		title_dirty = false;
 	}
+
+	// The source element is polled for changes, keep updating.
+	DirtyUpdate();
 }
 
 // Called when an element is destroyed.
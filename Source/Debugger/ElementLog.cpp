@@ -187,6 +187,9 @@ void ElementLog::OnUpdate()
 {
 	ElementDocument::OnUpdate();
 
+	// New log messages can arrive at any time, keep updating.
+	DirtyUpdate();
+
 	if (dirty_logs)
 	{
 		// Set the log content:
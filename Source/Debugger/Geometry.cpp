@@ -28,31 +28,58 @@
 
 #include "Geometry.h"
 #include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
-#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include <algorithm>
 
 namespace Rml {
 namespace Debugger {
 
 static Context* context;
 
+// Geometry may be referenced by recorded render commands until the next frame, thus it is kept alive and reused. The
+// source data of each entry is kept so that the geometry is only regenerated when its content changes, as releasing it
+// dirties the retained render commands of the context.
+struct PooledGeometry {
+	UniquePtr<::Rml::Geometry> geometry;
+	Vector<Vertex> vertices;
+	Vector<int> indices;
+};
+static Vector<PooledGeometry> geometry_pool;
+static size_t num_geometry_used = 0;
+
+static bool IsSameVertex(const Vertex& a, const Vertex& b)
+{
+	return a.position == b.position && a.tex_coord == b.tex_coord && a.colour.red == b.colour.red && a.colour.green == b.colour.green &&
+		a.colour.blue == b.colour.blue && a.colour.alpha == b.colour.alpha;
+}
+
 Geometry::Geometry()
 {
 }
 
 void Geometry::SetContext(Context* _context)
 {
+	if (context != _context)
+	{
+		geometry_pool.clear();
+		num_geometry_used = 0;
+	}
+
 	context = _context;
 }
 
+void Geometry::BeginFrame()
+{
+	num_geometry_used = 0;
+}
+
 // Renders a one-pixel rectangular outline.
 void Geometry::RenderOutline(const Vector2f origin, const Vector2f dimensions, const Colourb colour, float width)
 {
 	if (context == nullptr)
 		return;
 
-	RenderInterface* render_interface = context->GetRenderInterface();
-
 	Vertex vertices[4 * 4];
 	int indices[6 * 4];
 
@@ -61,7 +88,7 @@ void Geometry::RenderOutline(const Vector2f origin, const Vector2f dimensions, c
 	GeometryUtilities::GenerateQuad(vertices + 8, indices + 12, Vector2f(0, 0), Vector2f(width, dimensions.y), colour, 8);
 	GeometryUtilities::GenerateQuad(vertices + 12, indices + 18, Vector2f(dimensions.x - width, 0), Vector2f(width, dimensions.y), colour, 12);
 
-	render_interface->RenderGeometry(vertices, 4 * 4, indices, 6 * 4, 0, origin);
+	RenderGeometry(vertices, 4 * 4, indices, 6 * 4, origin);
 }
 
 // Renders a box.
@@ -70,14 +97,12 @@ void Geometry::RenderBox(const Vector2f origin, const Vector2f dimensions, const
 	if (context == nullptr)
 		return;
 
-	RenderInterface* render_interface = context->GetRenderInterface();
-
 	Vertex vertices[4];
 	int indices[6];
 
 	GeometryUtilities::GenerateQuad(vertices, indices, Vector2f(0, 0), Vector2f(dimensions.x, dimensions.y), colour, 0);
 
-	render_interface->RenderGeometry(vertices, 4, indices, 6, 0, origin);
+	RenderGeometry(vertices, 4, indices, 6, origin);
 }
 
 // Renders a box with a hole in the middle.
@@ -112,5 +137,31 @@ void Geometry::RenderBox(const Vector2f origin, const Vector2f dimensions, const
 	}
 }
 
+void Geometry::RenderGeometry(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, Vector2f translation)
+{
+	if (num_geometry_used == geometry_pool.size())
+		geometry_pool.push_back(PooledGeometry{MakeUnique<::Rml::Geometry>(context), {}, {}});
+
+	PooledGeometry& pooled = geometry_pool[num_geometry_used++];
+	::Rml::Geometry& geometry = *pooled.geometry;
+
+	const bool vertices_changed = (pooled.vertices.size() != (size_t)num_vertices ||
+		!std::equal(vertices, vertices + num_vertices, pooled.vertices.begin(), IsSameVertex));
+	const bool indices_changed = (pooled.indices.size() != (size_t)num_indices ||
+		!std::equal(indices, indices + num_indices, pooled.indices.begin()));
+
+	if (vertices_changed || indices_changed)
+	{
+		pooled.vertices.assign(vertices, vertices + num_vertices);
+		pooled.indices.assign(indices, indices + num_indices);
+
+		geometry.Release(true);
+		geometry.GetVertices() = pooled.vertices;
+		geometry.GetIndices() = pooled.indices;
+	}
+
+	geometry.Render(translation);
+}
+
 }
 }
@@ -30,6 +30,7 @@
 #define RMLUI_DEBUGGER_GEOMETRY_H
 
 #include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/Vertex.h"
 
 namespace Rml {
 
@@ -48,6 +49,8 @@ class Geometry
 public:
 	// Set the context to render through.
 	static void SetContext(Context* context);
+	// Marks the geometry rendered during the previous frame for reuse, call before rendering a new frame.
+	static void BeginFrame();
 
 	// Renders a one-pixel rectangular outline.
 	static void RenderOutline(Vector2f origin, Vector2f dimensions, Colourb colour, float width);
@@ -58,6 +61,9 @@ public:
 
 private:
 	Geometry();
+
+	// Renders the geometry through the context, so that it is recorded in order when retained rendering is enabled.
+	static void RenderGeometry(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, Vector2f translation);
 };
 
 }
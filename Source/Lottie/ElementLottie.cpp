@@ -27,6 +27,7 @@
  */
 
 #include "../../Include/RmlUi/Lottie/ElementLottie.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
@@ -68,6 +69,11 @@ void ElementLottie::OnRender()
 
 		UpdateTexture();
 		geometry.Render(GetAbsoluteOffset(Box::CONTENT).Round());
+
+		// The animation advances every frame, make sure we are rendered again when using retained rendering.
+		if (Context* context = GetContext())
+			context->DirtyRenderCommands();
+		DirtyDamageRegion();
 	}
 }
 
@@ -43,9 +43,15 @@ static DataExpressionInterface interface(&model, nullptr);
 
 TEST_CASE("data_expressions")
 {
+	struct Unit {
+		int hp = 75;
+		int max_hp = 120;
+	};
+
 	float radius = 6.0f;
 	String color_name = "color";
 	Colourb color_value = Colourb(180, 100, 255);
+	Unit unit;
 
 	DataModelConstructor constructor(&model, &type_register);
 	constructor.Bind("radius", &radius);
@@ -53,6 +59,12 @@ TEST_CASE("data_expressions")
 	constructor.BindFunc("color_value", [&](Variant& variant) {
 		variant = ToString(color_value);
 	});
+	if (auto unit_handle = constructor.RegisterStruct<Unit>())
+	{
+		unit_handle.RegisterMember("hp", &Unit::hp);
+		unit_handle.RegisterMember("max_hp", &Unit::max_hp);
+	}
+	constructor.Bind("unit", &unit);
 
 	nanobench::Bench bench;
 	bench.title("Data expression");
@@ -70,7 +82,10 @@ TEST_CASE("data_expressions")
 
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
-		DataInterpreter interpreter(program, addresses, interface);
+		AccessorList accessors;
+		for (const DataAddress& address : addresses)
+			accessors.push_back(interface.GetAccessor(address));
+		DataInterpreter interpreter(program, addresses, interface, &accessors);
 
 		bench.run(execute_name, [&] {
 			result &= interpreter.Run();
@@ -91,6 +106,12 @@ TEST_CASE("data_expressions")
 		"Complex (execute)"
 	);
 
+	bench_expression(
+		"unit.hp / unit.max_hp * 100 > 100 / (2 * 2)",
+		"Arithmetic (parse)",
+		"Arithmetic (execute)"
+	);
+
 	auto bench_assignment = [&](const String& expression, const char* parse_name, const char* execute_name) {
 		DataParser parser(expression, interface); 
 		
@@ -103,7 +124,10 @@ TEST_CASE("data_expressions")
 
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
-		DataInterpreter interpreter(program, addresses, interface);
+		AccessorList accessors;
+		for (const DataAddress& address : addresses)
+			accessors.push_back(interface.GetAccessor(address));
+		DataInterpreter interpreter(program, addresses, interface, &accessors);
 
 		bench.run(execute_name, [&] {
 			result &= interpreter.Run();
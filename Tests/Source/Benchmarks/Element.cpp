@@ -175,6 +175,45 @@ TEST_CASE("element.creation_and_destruction")
 }
 
 
+TEST_CASE("element.hit_test")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+	constexpr int num_rows = 200;
+	el->SetInnerRML(GenerateRml(num_rows));
+	context->Update();
+	context->Render();
+
+	MESSAGE(Rml::CreateString(128, "\nHit testing %d total elements.\n", GetNumDescendentElements(el)));
+
+	nanobench::Bench bench;
+	bench.title("Hit test");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	int i = 0;
+	bench.run("ProcessMouseMove", [&] {
+		i = (i + 1) % 500;
+		context->ProcessMouseMove(100 + i, 50 + (i * 7) % 300, 0);
+	});
+
+	bench.run("ProcessMouseMove + Update", [&] {
+		i = (i + 1) % 500;
+		context->ProcessMouseMove(100 + i, 50 + (i * 7) % 300, 0);
+		context->Update();
+	});
+
+	document->Close();
+}
+
+
 TEST_CASE("element.asymptotic_complexity")
 {
 	Context* context = TestsShell::GetContext();
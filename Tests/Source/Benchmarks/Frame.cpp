@@ -0,0 +1,296 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FrameBenchmark.h"
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/DataModelHandle.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/StyleSheet.h>
+#include <RmlUi/Core/StyleSheetContainer.h>
+#include <RmlUi/Core/Types.h>
+
+#include <doctest.h>
+
+using namespace Rml;
+
+// Each frame benchmark uses its own context and counting render interface, so that the render statistics only
+// include the document under test.
+static const Vector2i context_dimensions(1500, 800);
+
+static const String document_header_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; font-size: 14px; color: #222; left: 0; top: 0; right: 0; bottom: 0; }
+		%s
+	</style>
+</head>
+<body>
+)";
+
+static const String document_footer_rml = R"(
+</body>
+</rml>
+)";
+
+static String CreateDocumentRml(const String& rcss, const String& body_rml)
+{
+	return CreateString(document_header_rml.size() + rcss.size(), document_header_rml.c_str(), rcss.c_str()) + body_rml + document_footer_rml;
+}
+
+static const String lorem_ipsum = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna "
+	"aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat. Duis aute irure dolor in "
+	"reprehenderit in voluptate velit esse cillum dolore eu fugiat nulla pariatur. Excepteur sint occaecat cupidatat non proident, sunt in culpa qui "
+	"officia deserunt mollit anim id est laborum.";
+
+
+TEST_CASE("frame.large_list")
+{
+	TestsShell::GetContext();
+	TestsRenderInterface render_interface;
+	Context* context = Rml::CreateContext("frame", context_dimensions, &render_interface);
+	REQUIRE(context);
+
+	String rows;
+	for (int i = 0; i < 1000; i++)
+		rows += CreateString(256, R"(<div class="row"><span class="name">Item %d</span><span class="value">%d</span></div>)", i, (i * 7919) % 1000);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(CreateDocumentRml(R"(
+		#list { height: 600px; overflow: auto; }
+		.row { display: block; height: 20px; border-bottom: 1px #ccc; }
+		.row:nth-child(even) { background: #eee; }
+		.name { display: inline-block; width: 200px; }
+		.value { color: #36c; }
+	)", "<div id=\"list\">" + rows + "</div>"));
+	REQUIRE(document);
+	document->Show();
+
+	Element* list = document->GetElementById("list");
+	REQUIRE(list);
+
+	float scroll_top = 0.f;
+	FrameBenchmark::Run("large_list", context, render_interface, [&]() {
+		scroll_top = (scroll_top > 10000.f ? 0.f : scroll_top + 37.f);
+		list->SetScrollTop(scroll_top);
+	});
+
+	document->Close();
+	Rml::RemoveContext("frame");
+}
+
+TEST_CASE("frame.deep_nesting")
+{
+	TestsShell::GetContext();
+	TestsRenderInterface render_interface;
+	Context* context = Rml::CreateContext("frame", context_dimensions, &render_interface);
+	REQUIRE(context);
+
+	constexpr int depth = 200;
+	String rml;
+	for (int i = 0; i < depth; i++)
+		rml += "<div class=\"nest\">";
+	rml += "<div id=\"leaf\">Leaf</div>";
+	for (int i = 0; i < depth; i++)
+		rml += "</div>";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(CreateDocumentRml(R"(
+		.nest { display: block; padding: 1px 0 1px 1px; border-left: 1px #999; }
+		#leaf { width: 100px; height: 20px; }
+		#leaf.wide { width: 150px; }
+	)", rml));
+	REQUIRE(document);
+	document->Show();
+
+	Element* leaf = document->GetElementById("leaf");
+	REQUIRE(leaf);
+
+	// Toggling the class on the innermost element dirties the layout of all its ancestors.
+	FrameBenchmark::Run("deep_nesting", context, render_interface, [&]() {
+		leaf->SetClass("wide", !leaf->IsClassSet("wide"));
+	});
+
+	document->Close();
+	Rml::RemoveContext("frame");
+}
+
+TEST_CASE("frame.heavy_text")
+{
+	TestsShell::GetContext();
+	TestsRenderInterface render_interface;
+	Context* context = Rml::CreateContext("frame", context_dimensions, &render_interface);
+	REQUIRE(context);
+
+	String paragraphs;
+	for (int i = 0; i < 40; i++)
+		paragraphs += "<p>" + lorem_ipsum + "</p>";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(CreateDocumentRml(R"(
+		#text { width: 600px; }
+		p { display: block; margin: 0.5em 0; }
+	)", "<div id=\"text\">" + paragraphs + "</div>"));
+	REQUIRE(document);
+	document->Show();
+
+	Element* text = document->GetElementById("text");
+	REQUIRE(text);
+
+	// Changing the width reflows all the text.
+	bool narrow = false;
+	FrameBenchmark::Run("heavy_text", context, render_interface, [&]() {
+		narrow = !narrow;
+		text->SetProperty("width", narrow ? "590px" : "600px");
+	});
+
+	document->Close();
+	Rml::RemoveContext("frame");
+}
+
+TEST_CASE("frame.animations")
+{
+	TestsShell::GetContext();
+	TestsRenderInterface render_interface;
+	Context* context = Rml::CreateContext("frame", context_dimensions, &render_interface);
+	REQUIRE(context);
+
+	String boxes;
+	for (int i = 0; i < 300; i++)
+		boxes += CreateString(128, "<div class=\"box\" style=\"animation: %.2fs cubic-in-out infinite alternate pulse;\"/>", 0.5f + float((i * 37) % 100) / 100.f);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(CreateDocumentRml(R"(
+		@keyframes pulse {
+			from { opacity: 0.2; transform: rotate(0deg); background-color: #c33; }
+			to   { opacity: 1.0; transform: rotate(90deg); background-color: #33c; }
+		}
+		.box { display: inline-block; width: 30px; height: 30px; margin: 5px; background-color: #333; }
+	)", boxes));
+	REQUIRE(document);
+	document->Show();
+
+	// The animations progress with the elapsed time of the system interface.
+	FrameBenchmark::Run("animations", context, render_interface);
+
+	document->Close();
+	Rml::RemoveContext("frame");
+}
+
+TEST_CASE("frame.data_grid")
+{
+	TestsShell::GetContext();
+	TestsRenderInterface render_interface;
+	Context* context = Rml::CreateContext("frame", context_dimensions, &render_interface);
+	REQUIRE(context);
+
+	struct GridRow {
+		String name;
+		Vector<int> cells;
+	};
+	Vector<GridRow> rows(100);
+	for (int i = 0; i < (int)rows.size(); i++)
+	{
+		rows[i].name = CreateString(32, "Row %d", i);
+		rows[i].cells.resize(10, i);
+	}
+
+	DataModelConstructor constructor = context->CreateDataModel("grid");
+	REQUIRE(bool(constructor));
+	constructor.RegisterArray<Vector<int>>();
+	if (auto row_handle = constructor.RegisterStruct<GridRow>())
+	{
+		row_handle.RegisterMember("name", &GridRow::name);
+		row_handle.RegisterMember("cells", &GridRow::cells);
+	}
+	constructor.RegisterArray<Vector<GridRow>>();
+	constructor.Bind("rows", &rows);
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(CreateDocumentRml(R"(
+		.row { display: block; height: 18px; }
+		.row span { display: inline-block; width: 60px; }
+		.row span.high { color: #c33; }
+	)", R"(
+		<div data-model="grid">
+			<div class="row" data-for="row : rows">
+				<span>{{ row.name }}</span>
+				<span data-for="cell : row.cells" data-class-high="cell >= 50">{{ cell }}</span>
+			</div>
+		</div>
+	)"));
+	REQUIRE(document);
+	document->Show();
+
+	// Every frame updates a single column of the grid.
+	int frame_index = 0;
+	FrameBenchmark::Run("data_grid", context, render_interface, [&]() {
+		const size_t column = size_t(frame_index++) % 10;
+		for (GridRow& row : rows)
+			row.cells[column] += 1;
+		handle.DirtyVariable("rows");
+	});
+
+	document->Close();
+	Rml::RemoveContext("frame");
+}
+
+TEST_CASE("frame.stylesheet_reload")
+{
+	TestsShell::GetContext();
+	TestsRenderInterface render_interface;
+	Context* context = Rml::CreateContext("frame", context_dimensions, &render_interface);
+	REQUIRE(context);
+
+	const String rcss = R"(
+		body { font-family: LatoLatin; font-size: 14px; color: #222; left: 0; top: 0; right: 0; bottom: 0; }
+		div { display: block; }
+		.panel { margin: 4px; padding: 4px; border: 1px #999; }
+		.panel .title { font-size: 16px; color: #36c; }
+		.panel > .content { color: #444; }
+		.panel:nth-child(odd) { background: #eee; }
+	)";
+
+	String panels;
+	for (int i = 0; i < 100; i++)
+		panels += CreateString(256, R"(<div class="panel"><div class="title">Panel %d</div><div class="content">Some content</div></div>)", i);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(CreateDocumentRml("", panels));
+	REQUIRE(document);
+	document->Show();
+
+	// Parse and apply the style sheet on every frame, as done when reloading style sheets during development.
+	FrameBenchmark::Run("stylesheet_reload", context, render_interface, [&]() {
+		document->SetStyleSheetContainer(Factory::InstanceStyleSheetString(rcss));
+	});
+
+	document->Close();
+	Rml::RemoveContext("frame");
+}
@@ -0,0 +1,224 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FrameBenchmark.h"
+#include "../Common/TestsInterface.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/StringUtilities.h>
+#include <nanobench.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+
+using namespace ankerl;
+
+namespace {
+	std::atomic<size_t> num_allocations{ 0 };
+
+	Rml::Vector<FrameBenchmark::Result> results;
+}
+
+// Count every heap allocation made by the process, so that the allocations of a single frame can be measured.
+void* operator new(std::size_t size)
+{
+	num_allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* ptr = std::malloc(size == 0 ? 1 : size))
+		return ptr;
+	throw std::bad_alloc();
+}
+void* operator new[](std::size_t size)
+{
+	return ::operator new(size);
+}
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+void operator delete[](void* ptr) noexcept
+{
+	std::free(ptr);
+}
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+
+void FrameBenchmark::Run(const Rml::String& name, Rml::Context* context, TestsRenderInterface& render_interface, const Rml::Function<void()>& prepare_frame)
+{
+	auto frame = [&]() {
+		if (prepare_frame)
+			prepare_frame();
+		context->Update();
+		context->Render();
+	};
+
+	// Warm up any caches before measuring the statistics of a single frame.
+	frame();
+
+	render_interface.ResetCounters();
+	const size_t allocations_begin = GetNumAllocations();
+
+	frame();
+
+	Result result = {};
+	result.name = name;
+	result.allocations = GetNumAllocations() - allocations_begin;
+	result.draw_calls = render_interface.GetCounters().render_calls;
+	result.vertices = render_interface.GetCounters().num_vertices;
+	result.indices = render_interface.GetCounters().num_indices;
+
+	nanobench::Bench bench;
+	bench.title("Frame");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.minEpochIterations(10);
+	bench.run(name, frame);
+
+	result.frame_time_us = bench.results().back().median(nanobench::Result::Measure::elapsed) * 1.0e6;
+
+	results.push_back(std::move(result));
+}
+
+const Rml::Vector<FrameBenchmark::Result>& FrameBenchmark::GetResults()
+{
+	return results;
+}
+
+size_t FrameBenchmark::GetNumAllocations()
+{
+	return num_allocations.load(std::memory_order_relaxed);
+}
+
+bool FrameBenchmark::WriteJson(const Rml::String& file_name)
+{
+	std::ofstream file(file_name);
+	if (!file)
+	{
+		std::fprintf(stderr, "Could not open benchmark output file '%s'.\n", file_name.c_str());
+		return false;
+	}
+
+	// Each result is written on a single line, which keeps the baseline reader trivial.
+	file << "{\n\t\"benchmarks\": [\n";
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const Result& result = results[i];
+		file << Rml::CreateString(512, "\t\t{ \"name\": \"%s\", \"frame_time_us\": %.3f, \"draw_calls\": %zu, \"vertices\": %zu, \"indices\": %zu, \"allocations\": %zu }",
+			result.name.c_str(), result.frame_time_us, result.draw_calls, result.vertices, result.indices, result.allocations);
+		file << (i + 1 < results.size() ? ",\n" : "\n");
+	}
+	file << "\t]\n}\n";
+
+	return file.good();
+}
+
+static bool ReadString(const Rml::String& line, const char* key, Rml::String& out_value)
+{
+	const Rml::String pattern = Rml::CreateString(64, "\"%s\": \"", key);
+	const size_t begin = line.find(pattern);
+	if (begin == Rml::String::npos)
+		return false;
+
+	const size_t value_begin = begin + pattern.size();
+	const size_t value_end = line.find('"', value_begin);
+	if (value_end == Rml::String::npos)
+		return false;
+
+	out_value = line.substr(value_begin, value_end - value_begin);
+	return true;
+}
+
+static bool ReadNumber(const Rml::String& line, const char* key, double& out_value)
+{
+	const Rml::String pattern = Rml::CreateString(64, "\"%s\": ", key);
+	const size_t begin = line.find(pattern);
+	if (begin == Rml::String::npos)
+		return false;
+
+	out_value = std::strtod(line.c_str() + begin + pattern.size(), nullptr);
+	return true;
+}
+
+bool FrameBenchmark::CompareWithBaseline(const Rml::String& file_name, double tolerance)
+{
+	std::ifstream file(file_name);
+	if (!file)
+	{
+		std::fprintf(stderr, "Could not open benchmark baseline file '%s'.\n", file_name.c_str());
+		return false;
+	}
+
+	struct Metric {
+		const char* key;
+		double value;
+	};
+
+	int num_regressions = 0;
+	Rml::String line;
+
+	while (std::getline(file, line))
+	{
+		Rml::String name;
+		if (!ReadString(line, "name", name))
+			continue;
+
+		auto it = std::find_if(results.begin(), results.end(), [&name](const Result& result) { return result.name == name; });
+		if (it == results.end())
+			continue;
+
+		const Metric metrics[] = {
+			{ "frame_time_us", it->frame_time_us },
+			{ "draw_calls", double(it->draw_calls) },
+			{ "vertices", double(it->vertices) },
+			{ "allocations", double(it->allocations) },
+		};
+
+		for (const Metric& metric : metrics)
+		{
+			double baseline = 0.0;
+			if (!ReadNumber(line, metric.key, baseline))
+				continue;
+
+			if (metric.value > baseline * (1.0 + tolerance))
+			{
+				std::fprintf(stderr, "Benchmark regression in '%s': %s is %.3f, baseline is %.3f (tolerance %.1f%%).\n", name.c_str(), metric.key,
+					metric.value, baseline, tolerance * 100.0);
+				num_regressions += 1;
+			}
+		}
+	}
+
+	return num_regressions == 0;
+}
@@ -0,0 +1,67 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_TESTS_BENCHMARKS_FRAMEBENCHMARK_H
+#define RMLUI_TESTS_BENCHMARKS_FRAMEBENCHMARK_H
+
+#include <RmlUi/Core/Types.h>
+
+class TestsRenderInterface;
+
+namespace FrameBenchmark {
+
+	struct Result {
+		Rml::String name;
+		double frame_time_us;
+		size_t draw_calls;
+		size_t vertices;
+		size_t indices;
+		size_t allocations;
+	};
+
+	// Benchmarks complete frames of the context, where each frame calls the optional 'prepare_frame' function followed by
+	// 'Context::Update()' and 'Context::Render()'. In addition to the frame time, the draw calls and vertices submitted to
+	// the render interface and the number of heap allocations are recorded for a single frame. The result is stored for
+	// the final report.
+	void Run(const Rml::String& name, Rml::Context* context, TestsRenderInterface& render_interface, const Rml::Function<void()>& prepare_frame = nullptr);
+
+	const Rml::Vector<Result>& GetResults();
+
+	// Returns the total number of heap allocations made by the process so far.
+	size_t GetNumAllocations();
+
+	// Writes all results as JSON to the given file. Returns false if the file could not be written.
+	bool WriteJson(const Rml::String& file_name);
+
+	// Compares all results against a baseline written by 'WriteJson()'. Any result exceeding the corresponding baseline
+	// value by more than the given relative tolerance is reported as a regression. Results not present in the baseline
+	// are ignored. Returns false if the baseline could not be read or if any regressions were found.
+	bool CompareWithBaseline(const Rml::String& file_name, double tolerance);
+}
+
+#endif
@@ -27,6 +27,10 @@
  */
 
 #include "../Common/TestsShell.h"
+#include "FrameBenchmark.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 
 #define ANKERL_NANOBENCH_IMPLEMENT
 #include <nanobench.h>
@@ -35,12 +39,34 @@
 #include <doctest.h>
 
 
+// In addition to the doctest options, the following options are supported:
+//   --json=<file>          Write the frame benchmark results as JSON to the given file.
+//   --baseline=<file>      Compare the frame benchmark results against a JSON file previously written by --json, fails on any regressions.
+//   --tolerance=<percent>  The relative amount a result may exceed the baseline before it is considered a regression, default 10.
 int main(int argc, char** argv) {
 
+    Rml::String json_file;
+    Rml::String baseline_file;
+    double tolerance = 0.1;
+
+    Rml::Vector<char*> doctest_args;
+    for (int i = 0; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        if (std::strncmp(arg, "--json=", 7) == 0)
+            json_file = arg + 7;
+        else if (std::strncmp(arg, "--baseline=", 11) == 0)
+            baseline_file = arg + 11;
+        else if (std::strncmp(arg, "--tolerance=", 12) == 0)
+            tolerance = std::atof(arg + 12) / 100.0;
+        else
+            doctest_args.push_back(argv[i]);
+    }
+
     // Initialize and run doctest
     doctest::Context doctest_context;
 
-    doctest_context.applyCommandLine(argc, argv);
+    doctest_context.applyCommandLine((int)doctest_args.size(), doctest_args.data());
 
     int doctest_result = doctest_context.run();
 
@@ -51,5 +77,11 @@ int main(int argc, char** argv) {
     // Clean everything up here.
     TestsShell::ShutdownShell();
 
+    if (!json_file.empty() && !FrameBenchmark::WriteJson(json_file))
+        doctest_result = EXIT_FAILURE;
+
+    if (!baseline_file.empty() && !FrameBenchmark::CompareWithBaseline(baseline_file, tolerance))
+        doctest_result = EXIT_FAILURE;
+
     return doctest_result;
 }
@@ -72,9 +72,11 @@ void TestsSystemInterface::SetNumExpectedWarnings(int in_num_expected_warnings)
 	num_expected_warnings = in_num_expected_warnings;
 }
 
-void TestsRenderInterface::RenderGeometry(Rml::Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, const Rml::TextureHandle /*texture*/, const Rml::Vector2f& /*translation*/)
+void TestsRenderInterface::RenderGeometry(Rml::Vertex* /*vertices*/, int num_vertices, int* /*indices*/, int num_indices, const Rml::TextureHandle /*texture*/, const Rml::Vector2f& /*translation*/)
 {
 	counters.render_calls += 1;
+	counters.num_vertices += (size_t)num_vertices;
+	counters.num_indices += (size_t)num_indices;
 }
 
 void TestsRenderInterface::EnableScissorRegion(bool /*enable*/)
@@ -55,6 +55,8 @@ class TestsRenderInterface : public Rml::RenderInterface
 public:
 	struct Counters {
 		size_t render_calls;
+		size_t num_vertices;
+		size_t num_indices;
 		size_t enable_scissor;
 		size_t set_scissor;
 		size_t load_texture;
@@ -185,9 +185,11 @@ Rml::String TestsShell::GetRenderStats()
 	shell_context->Render();
 	auto& counters = shell_render_interface.GetCounters();
 
-	result = Rml::CreateString(256,
+	result = Rml::CreateString(512,
 		"Context::Render() stats:\n"
 		"  Render calls: %zu\n"
+		"  Vertices: %zu\n"
+		"  Indices: %zu\n"
 		"  Scissor enable: %zu\n"
 		"  Scissor set: %zu\n"
 		"  Texture load: %zu\n"
@@ -195,6 +197,8 @@ Rml::String TestsShell::GetRenderStats()
 		"  Texture release: %zu\n"
 		"  Transform set: %zu",
 		counters.render_calls,
+		counters.num_vertices,
+		counters.num_indices,
 		counters.enable_scissor,
 		counters.set_scissor,
 		counters.load_texture,
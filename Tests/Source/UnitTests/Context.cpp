@@ -0,0 +1,916 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/EventListener.h>
+#include <RmlUi/Core/RenderInterface.h>
+#include <doctest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace Rml;
+
+static const String document_retained_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+		}
+		div {
+			display: block;
+			height: 20px;
+			background-color: #f00;
+		}
+	</style>
+</head>
+
+<body>
+<div/>
+<div/>
+<div id="last"/>
+</body>
+</rml>
+)";
+
+static const String document_damage_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+			font-family: LatoLatin;
+		}
+		div {
+			height: 20px;
+			width: 100px;
+			background-color: #f00;
+		}
+	</style>
+</head>
+
+<body>
+<div/>
+<div id="second"/>
+<div id="third"/>
+</body>
+</rml>
+)";
+
+class RetainedRenderInterface : public RenderInterface {
+public:
+	void RenderGeometry(Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, TextureHandle /*texture*/, const Vector2f& /*translation*/) override
+	{
+		num_render_geometry += 1;
+	}
+
+	void EnableScissorRegion(bool /*enable*/) override {}
+	void SetScissorRegion(int /*x*/, int /*y*/, int /*width*/, int /*height*/) override {}
+
+	void RenderCommands(RenderCommandList& command_list) override
+	{
+		num_render_commands += 1;
+		list = &command_list;
+		RenderInterface::RenderCommands(command_list);
+	}
+
+	int num_render_geometry = 0;
+	int num_render_commands = 0;
+	const RenderCommandList* list = nullptr;
+};
+
+TEST_CASE("context.retained_rendering")
+{
+	TestsShell::GetContext();
+
+	RetainedRenderInterface render_interface;
+	Context* context = Rml::CreateContext("retained", Vector2i(1000, 800), &render_interface);
+	REQUIRE(context);
+
+	context->EnableRetainedRendering(true);
+	CHECK(context->IsRetainedRenderingEnabled());
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_retained_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	REQUIRE(render_interface.list);
+	const RenderCommandList& list = *render_interface.list;
+	CHECK(render_interface.num_render_commands == 1);
+
+	// All three backgrounds share the same state and should be merged into a single draw call.
+	REQUIRE(list.commands.size() == 1);
+	CHECK(list.commands[0].num_vertices == 3 * 4);
+	CHECK(list.commands[0].num_indices == 3 * 6);
+	CHECK(list.vertices[0].colour.red == 255);
+	CHECK(render_interface.num_render_geometry == 1);
+
+	// Let any structural changes from loading the document settle.
+	context->Update();
+	context->Render();
+	CHECK(render_interface.num_render_commands == 2);
+	CHECK(render_interface.num_render_geometry == 2);
+
+	// Nothing changed, the list should be submitted again without being recorded.
+	const int version = list.version;
+	context->Update();
+	context->Render();
+	CHECK(render_interface.num_render_commands == 3);
+	CHECK(render_interface.num_render_geometry == 3);
+	CHECK(list.version == version);
+
+	// Changing a property should record the list again.
+	document->GetElementById("last")->SetProperty("background-color", "#00f");
+	context->Update();
+	context->Render();
+	CHECK(list.version != version);
+	REQUIRE(list.commands.size() == 1);
+	CHECK(list.vertices.size() == 3 * 4);
+	CHECK(list.vertices.back().colour.blue == 255);
+
+	// Disabling retained rendering submits the draw calls immediately.
+	context->EnableRetainedRendering(false);
+	render_interface.num_render_commands = 0;
+	render_interface.num_render_geometry = 0;
+	context->Update();
+	context->Render();
+	CHECK(render_interface.num_render_commands == 0);
+	CHECK(render_interface.num_render_geometry == 3);
+
+	document->Close();
+	Rml::RemoveContext("retained");
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("context.damage_region")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_damage_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Vector2i origin, dimensions;
+
+	// Let any structural changes from loading the document settle.
+	context->Update();
+	CHECK(context->GetDamageRegion(origin, dimensions));
+	context->Render();
+	context->Update();
+	context->Render();
+
+	context->Update();
+	CHECK(!context->GetDamageRegion(origin, dimensions));
+	context->Render();
+
+	Element* second = document->GetElementById("second");
+	second->SetProperty("background-color", "#00f");
+	context->Update();
+	REQUIRE(context->GetDamageRegion(origin, dimensions));
+	CHECK(origin == Vector2i(0, 20));
+	CHECK(dimensions == Vector2i(100, 20));
+	context->Render();
+
+	// Both the old and the new area of a moved element are damaged.
+	second->SetProperty("margin-left", "50px");
+	context->Update();
+	REQUIRE(context->GetDamageRegion(origin, dimensions));
+	CHECK(origin == Vector2i(0, 20));
+	CHECK(dimensions == Vector2i(150, 20));
+	context->Render();
+
+	context->Update();
+	CHECK(!context->GetDamageRegion(origin, dimensions));
+	context->Render();
+
+	// Removing an element damages its area, and moves the following element up.
+	document->RemoveChild(second);
+	context->Update();
+	REQUIRE(context->GetDamageRegion(origin, dimensions));
+	CHECK(origin == Vector2i(0, 20));
+	CHECK(dimensions == Vector2i(150, 40));
+	context->Render();
+
+	context->DirtyDamageRegion();
+	REQUIRE(context->GetDamageRegion(origin, dimensions));
+	CHECK(origin == Vector2i(0, 0));
+	CHECK(dimensions == context->GetDimensions());
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("context.parallel_style_matching")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	String rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+		p { color: #f00; }
+		.group p { color: #00f; }
+		.group p.odd { color: #0f0; }
+		body.alt .group p { color: #ff0; }
+		.group:nth-child(2) { color: #fff; }
+	</style>
+</head>
+<body>
+)";
+	const int num_groups = 20;
+	const int num_items = 50;
+	for (int i = 0; i < num_groups; i++)
+	{
+		rml += "<div class=\"group\">";
+		for (int j = 0; j < num_items; j++)
+			rml += (j % 2 ? "<p class=\"odd\"/>" : "<p/>");
+		rml += "</div>";
+	}
+	rml += "<p id=\"outside\"/></body></rml>";
+
+	context->EnableParallelStyleMatching(true);
+	CHECK(context->IsParallelStyleMatchingEnabled());
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml);
+	REQUIRE(document);
+	document->Show();
+
+	// The whole document is matched in parallel on the first update, and again after the body's class changes.
+	auto check_colours = [&](const char* even_colour, const char* odd_colour) {
+		int num_wrong = 0;
+		for (int i = 0; i < num_groups; i++)
+		{
+			Element* group = document->GetChild(i);
+			for (int j = 0; j < num_items; j++)
+			{
+				const String expected = (j % 2 ? odd_colour : even_colour);
+				if (group->GetChild(j)->GetProperty("color")->ToString() != "rgba(" + expected + ",255)")
+					num_wrong += 1;
+			}
+		}
+		CHECK(num_wrong == 0);
+	};
+
+	context->Update();
+	check_colours("0,0,255", "0,255,0");
+
+	document->SetClass("alt", true);
+	context->Update();
+	check_colours("255,255,0", "255,255,0");
+
+	Element* outside = document->GetElementById("outside");
+	REQUIRE(outside);
+	CHECK(outside->GetProperty<Colourb>("color").red == 255);
+	CHECK(outside->GetProperty<Colourb>("color").green == 0);
+	CHECK(document->GetChild(1)->GetProperty<Colourb>("color").green == 255);
+
+	context->EnableParallelStyleMatching(false);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+class ArenaRenderInterface : public RenderInterface {
+public:
+	void RenderGeometry(Vertex* vertices, int num_vertices, int* /*indices*/, int /*num_indices*/, TextureHandle /*texture*/, const Vector2f& /*translation*/) override
+	{
+		draw_calls.push_back(DrawCall{ vertices, num_vertices, vertices[0].colour });
+	}
+
+	void EnableScissorRegion(bool /*enable*/) override {}
+	void SetScissorRegion(int /*x*/, int /*y*/, int /*width*/, int /*height*/) override {}
+
+	struct DrawCall {
+		const Vertex* vertices;
+		int num_vertices;
+		Colourb colour;
+	};
+	Vector<DrawCall> draw_calls;
+};
+
+TEST_CASE("context.geometry_arena")
+{
+	TestsShell::GetContext();
+
+	ArenaRenderInterface render_interface;
+	Context* context = Rml::CreateContext("arena", Vector2i(1000, 800), &render_interface);
+	REQUIRE(context);
+
+	context->EnableGeometryArena(true);
+	CHECK(context->IsGeometryArenaEnabled());
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_retained_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	// The backgrounds are stored next to each other in the same slab.
+	auto& draw_calls = render_interface.draw_calls;
+	REQUIRE(draw_calls.size() == 3);
+	CHECK(draw_calls[1].vertices == draw_calls[0].vertices + draw_calls[0].num_vertices);
+	CHECK(draw_calls[2].vertices == draw_calls[1].vertices + draw_calls[1].num_vertices);
+	CHECK(draw_calls[2].colour.red == 255);
+
+	// Regenerated geometry is moved out of the arena and back in, the freed space is reused.
+	const Vertex* last_vertices = draw_calls[2].vertices;
+	document->GetElementById("last")->SetProperty("background-color", "#00f");
+	draw_calls.clear();
+	context->Update();
+	context->Render();
+
+	REQUIRE(draw_calls.size() == 3);
+	CHECK(draw_calls[2].vertices == last_vertices);
+	CHECK(draw_calls[2].colour.blue == 255);
+
+	// Geometry remains in the arena after disabling it, until modified.
+	context->EnableGeometryArena(false);
+	CHECK_FALSE(context->IsGeometryArenaEnabled());
+	document->GetElementById("last")->SetProperty("background-color", "#0f0");
+	draw_calls.clear();
+	context->Update();
+	context->Render();
+
+	REQUIRE(draw_calls.size() == 3);
+	CHECK(draw_calls[1].vertices == draw_calls[0].vertices + draw_calls[0].num_vertices);
+	CHECK(draw_calls[2].vertices != last_vertices);
+	CHECK(draw_calls[2].colour.green == 255);
+
+	document->Close();
+	Rml::RemoveContext("arena");
+
+	TestsShell::ShutdownShell();
+}
+
+class CompilingRenderInterface : public RenderInterface {
+public:
+	void RenderGeometry(Vertex* vertices, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, TextureHandle /*texture*/, const Vector2f& /*translation*/) override
+	{
+		immediate_alphas.push_back(vertices[0].colour.alpha);
+	}
+
+	CompiledGeometryHandle CompileGeometry(Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, TextureHandle /*texture*/) override
+	{
+		num_compiled += 1;
+		return CompiledGeometryHandle(num_compiled);
+	}
+	void RenderCompiledGeometry(CompiledGeometryHandle /*geometry*/, const Vector2f& /*translation*/) override
+	{
+		num_render_compiled += 1;
+	}
+	bool RenderCompiledGeometryWithOpacity(CompiledGeometryHandle /*geometry*/, const Vector2f& /*translation*/, float opacity) override
+	{
+		if (!supports_opacity)
+			return false;
+		compiled_opacities.push_back(opacity);
+		return true;
+	}
+	void ReleaseCompiledGeometry(CompiledGeometryHandle /*geometry*/) override {}
+
+	void EnableScissorRegion(bool /*enable*/) override {}
+	void SetScissorRegion(int /*x*/, int /*y*/, int /*width*/, int /*height*/) override {}
+
+	void Reset()
+	{
+		immediate_alphas.clear();
+		compiled_opacities.clear();
+		num_render_compiled = 0;
+	}
+
+	bool supports_opacity = false;
+	Vector<byte> immediate_alphas;
+	Vector<float> compiled_opacities;
+	int num_compiled = 0;
+	int num_render_compiled = 0;
+};
+
+TEST_CASE("context.render_time_opacity")
+{
+	TestsShell::GetContext();
+
+	CompilingRenderInterface render_interface;
+	Context* context = Rml::CreateContext("opacity", Vector2i(1000, 800), &render_interface);
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_retained_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	CHECK(render_interface.num_compiled == 3);
+	CHECK(render_interface.num_render_compiled == 3);
+	CHECK(render_interface.immediate_alphas.empty());
+
+	// Translucent geometry is rendered from a scaled copy of its vertices, the compiled geometry is kept.
+	Element* last = document->GetElementById("last");
+	last->SetProperty("opacity", "0.5");
+	render_interface.Reset();
+	context->Update();
+	context->Render();
+
+	CHECK(render_interface.num_compiled == 3);
+	CHECK(render_interface.num_render_compiled == 2);
+	REQUIRE(render_interface.immediate_alphas.size() == 1);
+	CHECK(render_interface.immediate_alphas[0] == 127);
+
+	// Inherited opacity is propagated to the children.
+	last->RemoveProperty("opacity");
+	document->SetProperty("opacity", "0.2");
+	render_interface.Reset();
+	context->Update();
+	context->Render();
+
+	CHECK(last->GetComputedValues().opacity == 0.2f);
+	CHECK(render_interface.num_compiled == 3);
+	CHECK(render_interface.num_render_compiled == 0);
+	REQUIRE(render_interface.immediate_alphas.size() == 3);
+	CHECK(render_interface.immediate_alphas[2] == 51);
+
+	// Fully transparent geometry is skipped.
+	document->SetProperty("opacity", "0");
+	render_interface.Reset();
+	context->Update();
+	context->Render();
+
+	CHECK(render_interface.num_render_compiled == 0);
+	CHECK(render_interface.immediate_alphas.empty());
+
+	document->RemoveProperty("opacity");
+	render_interface.Reset();
+	context->Update();
+	context->Render();
+
+	CHECK(last->GetComputedValues().opacity == 1.f);
+	CHECK(render_interface.num_compiled == 3);
+	CHECK(render_interface.num_render_compiled == 3);
+
+	// Render interfaces supporting it render translucent geometry compiled, also while the opacity changes.
+	render_interface.supports_opacity = true;
+	for (const char* opacity : { "0.5", "0.25" })
+	{
+		last->SetProperty("opacity", opacity);
+		render_interface.Reset();
+		context->Update();
+		context->Render();
+
+		CHECK(render_interface.num_compiled == 3);
+		CHECK(render_interface.num_render_compiled == 2);
+		CHECK(render_interface.immediate_alphas.empty());
+		CHECK(render_interface.compiled_opacities == Vector<float>{ last->GetComputedValues().opacity });
+	}
+
+	// Decorators are rendered with the opacity too, without being regenerated when it changes.
+	last->SetProperty("decorator", "gradient( horizontal #ff0000ff #0000ffff )");
+	context->Update();
+	context->Render();
+	CHECK(render_interface.num_compiled == 4);
+
+	last->SetProperty("opacity", "0.5");
+	render_interface.Reset();
+	context->Update();
+	context->Render();
+
+	CHECK(render_interface.num_compiled == 4);
+	CHECK(render_interface.compiled_opacities == Vector<float>{ 0.5f, 0.5f });
+
+	// Recorded render commands apply the opacity the same way, or fall back to their translucent copy of the geometry.
+	context->EnableRetainedRendering(true);
+	render_interface.Reset();
+	context->Update();
+	context->Render();
+
+	CHECK(render_interface.num_compiled == 4);
+	CHECK(render_interface.num_render_compiled == 2);
+	CHECK(render_interface.compiled_opacities == Vector<float>{ 0.5f, 0.5f });
+	CHECK(render_interface.immediate_alphas.empty());
+
+	render_interface.supports_opacity = false;
+	render_interface.Reset();
+	context->Render();
+
+	CHECK(render_interface.num_render_compiled == 2);
+	REQUIRE(render_interface.immediate_alphas.size() == 2);
+	CHECK(render_interface.immediate_alphas[0] == 127);
+
+	document->Close();
+	Rml::RemoveContext("opacity");
+
+	TestsShell::ShutdownShell();
+}
+
+class AsyncTextureRenderInterface : public RenderInterface {
+public:
+	void RenderGeometry(Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, TextureHandle texture, const Vector2f& /*translation*/) override
+	{
+		if (texture)
+			num_textured_draws += 1;
+	}
+
+	void EnableScissorRegion(bool /*enable*/) override {}
+	void SetScissorRegion(int /*x*/, int /*y*/, int /*width*/, int /*height*/) override {}
+
+	bool LoadTexture(TextureHandle& texture_handle, Vector2i& texture_dimensions, const String& /*source*/) override
+	{
+		num_loaded += 1;
+		texture_handle = 2;
+		texture_dimensions = Vector2i(20, 10);
+		return true;
+	}
+
+	bool DecodeTexture(UniquePtr<byte[]>& data, Vector2i& dimensions, const String& source) override
+	{
+		while (!decoding_allowed)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+		// Sources named 'fallback' are loaded through LoadTexture() instead.
+		bool result = false;
+		if (source.find("fallback") == String::npos)
+		{
+			dimensions = Vector2i(40, 30);
+			data.reset(new byte[dimensions.x * dimensions.y * 4]);
+			result = true;
+		}
+
+		num_decoded += 1;
+		return result;
+	}
+
+	bool GenerateTexture(TextureHandle& texture_handle, const byte* /*source*/, const Vector2i& /*source_dimensions*/) override
+	{
+		num_generated += 1;
+		texture_handle = 1;
+		return true;
+	}
+
+	std::atomic<bool> decoding_allowed{ false };
+	std::atomic<int> num_decoded{ 0 };
+	int num_textured_draws = 0;
+	int num_loaded = 0;
+	int num_generated = 0;
+};
+
+struct LoadEventListener : EventListener {
+	void ProcessEvent(Event& event) override { loaded.push_back(event.GetTargetElement()->GetId()); }
+	StringList loaded;
+};
+
+static const String document_async_texture_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+</head>
+<body>
+<img id="decoded" src="decoded.tga"/>
+<img id="fallback" src="fallback.tga"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("context.async_texture_loading")
+{
+	TestsShell::GetContext();
+
+	AsyncTextureRenderInterface render_interface;
+	Context* context = Rml::CreateContext("async", Vector2i(1000, 800), &render_interface);
+	REQUIRE(context);
+
+	context->EnableAsyncTextureLoading(true);
+	CHECK(context->IsAsyncTextureLoadingEnabled());
+
+	// With a tiny budget, only a single texture is generated during each update.
+	context->SetTextureUploadBudget(1e-9);
+	CHECK(context->GetTextureUploadBudget() == 1e-9);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_async_texture_rml);
+	REQUIRE(document);
+	document->Show();
+
+	LoadEventListener listener;
+	document->AddEventListener(EventId::Load, &listener, true);
+
+	Element* decoded = document->GetElementById("decoded");
+	Element* fallback = document->GetElementById("fallback");
+
+	// The images are laid out without their textures, and rendered as transparent placeholders.
+	context->Update();
+	context->Render();
+
+	CHECK(decoded->GetBox().GetSize().x == 0.f);
+	CHECK(render_interface.num_generated == 0);
+	CHECK(render_interface.num_loaded == 0);
+	CHECK(render_interface.num_textured_draws == 0);
+
+	render_interface.decoding_allowed = true;
+	for (int i = 0; i < 1000 && render_interface.num_decoded < 2; i++)
+		std::this_thread::sleep_for(std::chrono::milliseconds(2));
+	REQUIRE(render_interface.num_decoded == 2);
+
+	context->Update();
+	CHECK(listener.loaded.size() == 1);
+	context->Update();
+	context->Render();
+
+	// Both images are laid out again once their textures are available, and the load event is dispatched on them.
+	REQUIRE(listener.loaded.size() == 2);
+	CHECK(std::find(listener.loaded.begin(), listener.loaded.end(), "decoded") != listener.loaded.end());
+	CHECK(std::find(listener.loaded.begin(), listener.loaded.end(), "fallback") != listener.loaded.end());
+	CHECK(decoded->GetBox().GetSize() == Vector2f(40, 30));
+	CHECK(fallback->GetBox().GetSize() == Vector2f(20, 10));
+	CHECK(render_interface.num_generated == 1);
+	CHECK(render_interface.num_loaded == 1);
+	CHECK(render_interface.num_textured_draws == 2);
+
+	// Another context sharing the render interface also loads its textures asynchronously, and generates them itself.
+	{
+		Context* shared_context = Rml::CreateContext("async_shared", Vector2i(1000, 800), &render_interface);
+		REQUIRE(shared_context);
+		CHECK_FALSE(shared_context->IsAsyncTextureLoadingEnabled());
+
+		ElementDocument* shared_document = shared_context->LoadDocumentFromMemory(R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+</head>
+<body>
+<img id="shared" src="shared.tga"/>
+</body>
+</rml>
+)");
+		REQUIRE(shared_document);
+		shared_document->Show();
+
+		Element* shared = shared_document->GetElementById("shared");
+		for (int i = 0; i < 1000 && shared->GetBox().GetSize().x == 0.f; i++)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+			shared_context->Update();
+		}
+
+		CHECK(shared->GetBox().GetSize() == Vector2f(40, 30));
+		CHECK(render_interface.num_generated == 2);
+
+		shared_document->Close();
+		Rml::RemoveContext("async_shared");
+	}
+
+	// Disabling asynchronous loading cancels pending loads, the waiting images are then laid out with textures loaded
+	// synchronously.
+	render_interface.decoding_allowed = false;
+	document->AppendChild(document->CreateElement("img"))->SetAttribute("src", "cancelled.tga");
+	Element* cancelled = document->GetChild(document->GetNumChildren() - 1);
+	context->Update();
+	context->Render();
+	CHECK(cancelled->GetBox().GetSize().x == 0.f);
+
+	render_interface.decoding_allowed = true;
+	context->EnableAsyncTextureLoading(false);
+	CHECK_FALSE(context->IsAsyncTextureLoadingEnabled());
+	context->Update();
+
+	CHECK(cancelled->GetBox().GetSize() == Vector2f(20, 10));
+	CHECK(render_interface.num_loaded == 2);
+	CHECK(listener.loaded.size() == 2);
+
+	document->RemoveEventListener(EventId::Load, &listener, true);
+	document->Close();
+	Rml::RemoveContext("async");
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("context.hit_test_grid")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	String rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 1000px;
+			height: 800px;
+		}
+		div.cell {
+			float: left;
+			width: 50px;
+			height: 50px;
+		}
+		#overlay {
+			position: absolute;
+			left: 0;
+			top: 0;
+			width: 100px;
+			height: 100px;
+		}
+		#transformed {
+			position: absolute;
+			left: 500px;
+			top: 500px;
+			width: 100px;
+			height: 100px;
+			transform: translateX(200px);
+		}
+	</style>
+</head>
+<body>
+)";
+	const int num_cells = 200;
+	for (int i = 0; i < num_cells; i++)
+		rml += "<div class=\"cell\" id=\"cell" + ToString(i) + "\"/>";
+	rml += "<div id=\"overlay\"/><div id=\"transformed\"/></body></rml>";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	auto element_at = [&](float x, float y) -> String {
+		Element* element = context->GetElementAtPoint(Vector2f(x, y));
+		return element ? element->GetId() : String();
+	};
+
+	// Twenty cells on each row.
+	CHECK(element_at(125.f, 25.f) == "cell2");
+	CHECK(element_at(975.f, 475.f) == "cell199");
+	CHECK(element_at(175.f, 75.f) == "cell23");
+	CHECK(element_at(25.f, 25.f) == "overlay");
+	CHECK(element_at(25.f, 600.f) == document->GetId());
+
+	// Transformed elements are tested at their projected position.
+	CHECK(element_at(750.f, 550.f) == "transformed");
+	CHECK(element_at(550.f, 550.f) == document->GetId());
+
+	// Moved elements are found at their new position after the update.
+	document->GetElementById("overlay")->SetProperty("left", "200px");
+	context->Update();
+	CHECK(element_at(25.f, 25.f) == "cell0");
+	CHECK(element_at(225.f, 25.f) == "overlay");
+
+	// Removed elements are never returned, even before the next update.
+	document->RemoveChild(document->GetElementById("overlay"));
+	CHECK(element_at(225.f, 25.f) == "cell4");
+
+	// Elements ignoring pointer events are skipped.
+	document->GetElementById("cell4")->SetProperty("pointer-events", "none");
+	context->Update();
+	CHECK(element_at(225.f, 25.f) == document->GetId());
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+class CountingEventListener : public EventListener {
+public:
+	void ProcessEvent(Event& event) override
+	{
+		counts[event.GetType()] += 1;
+		if (event == EventId::Mousemove)
+			last_mouse_x = event.GetParameter("mouse_x", 0);
+		else if (event == EventId::Mousescroll)
+			wheel_delta += event.GetParameter("wheel_delta", 0.f);
+	}
+
+	UnorderedMap<String, int> counts;
+	int last_mouse_x = 0;
+	float wheel_delta = 0.f;
+};
+
+TEST_CASE("context.input_event_batch")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_damage_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	CountingEventListener listener;
+	document->AddEventListener(EventId::Mouseover, &listener);
+	document->AddEventListener(EventId::Mousemove, &listener);
+	document->AddEventListener(EventId::Mousescroll, &listener);
+	document->AddEventListener(EventId::Mousedown, &listener);
+
+	auto mouse_move = [](int x, int y) {
+		InputEvent event;
+		event.type = InputEvent::Type::MouseMove;
+		event.mouse_position = Vector2i(x, y);
+		return event;
+	};
+	auto mouse_wheel = [](float delta) {
+		InputEvent event;
+		event.type = InputEvent::Type::MouseWheel;
+		event.wheel_delta = delta;
+		return event;
+	};
+
+	// Moves across all three elements are coalesced into a single move onto the last one.
+	Vector<InputEvent> events;
+	for (int i = 0; i < 60; i++)
+		events.push_back(mouse_move(10 + i, i));
+	events.push_back(mouse_wheel(1.f));
+	events.push_back(mouse_wheel(2.f));
+
+	CHECK_FALSE(context->ProcessInputEvents(events));
+	CHECK(listener.counts["mousemove"] == 1);
+	// Mouseover is sent to the document and bubbles up from the third element, the first two are never hovered.
+	CHECK(listener.counts["mouseover"] == 2);
+	CHECK(listener.counts["mousescroll"] == 1);
+	CHECK(listener.last_mouse_x == 69);
+	CHECK(listener.wheel_delta == 3.f);
+	CHECK(context->GetHoverElement() == document->GetElementById("third"));
+
+	// Other events split the runs of moves, and are processed in order.
+	listener.counts.clear();
+	events.clear();
+	events.push_back(mouse_move(10, 5));
+	events.push_back(mouse_move(11, 5));
+	InputEvent button_down;
+	button_down.type = InputEvent::Type::MouseButtonDown;
+	events.push_back(button_down);
+	events.push_back(mouse_move(12, 25));
+
+	context->ProcessInputEvents(events);
+	CHECK(listener.counts["mousemove"] == 2);
+	CHECK(listener.counts["mousedown"] == 1);
+	CHECK(listener.last_mouse_x == 12);
+	CHECK(context->GetHoverElement() == document->GetElementById("second"));
+
+	InputEvent button_up;
+	button_up.type = InputEvent::Type::MouseButtonUp;
+	context->ProcessInputEvents({button_up});
+
+	document->RemoveEventListener(EventId::Mouseover, &listener);
+	document->RemoveEventListener(EventId::Mousemove, &listener);
+	document->RemoveEventListener(EventId::Mousescroll, &listener);
+	document->RemoveEventListener(EventId::Mousedown, &listener);
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
@@ -31,6 +31,8 @@
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FontEngineInterface.h>
+#include <RmlUi/Core/RenderInterface.h>
 #include <doctest.h>
 #include <algorithm>
 
@@ -122,3 +124,133 @@ TEST_CASE("core.texture_source_list")
 
 	TestsShell::ShutdownShell();
 }
+
+class GlyphRenderInterface : public RenderInterface {
+public:
+	void RenderGeometry(Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, TextureHandle /*texture*/, const Vector2f& /*translation*/) override {}
+	void EnableScissorRegion(bool /*enable*/) override {}
+	void SetScissorRegion(int /*x*/, int /*y*/, int /*width*/, int /*height*/) override {}
+
+	bool GenerateTexture(TextureHandle& texture_handle, const byte* /*source*/, const Vector2i& /*source_dimensions*/) override
+	{
+		num_generate_texture += 1;
+		texture_handle = TextureHandle(num_generate_texture);
+		return true;
+	}
+
+	bool UpdateTexture(TextureHandle /*texture_handle*/, const byte* /*source*/, const Vector2i& /*source_dimensions*/, const Vector2i& /*offset*/) override
+	{
+		if (!support_updates)
+			return false;
+		num_update_texture += 1;
+		return true;
+	}
+
+	bool support_updates = true;
+	int num_generate_texture = 0;
+	int num_update_texture = 0;
+};
+
+TEST_CASE("core.font_glyph_append")
+{
+	TestsShell::GetContext();
+
+	GlyphRenderInterface render_interface;
+	Context* context = Rml::CreateContext("glyphs", Vector2i(400, 200), &render_interface);
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; font-size: 17px; }
+	</style>
+</head>
+<body>abc</body>
+</rml>
+)");
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	const FontFaceHandle handle = document->GetFontFaceHandle();
+	REQUIRE(handle);
+	const int version = GetFontEngineInterface()->GetVersion(handle);
+	const int num_generated = render_interface.num_generate_texture;
+	CHECK(num_generated > 0);
+
+	// New glyphs are placed in the free space of the existing texture, and only their regions are uploaded.
+	document->SetInnerRML(u8"abc\u00e9\u00e5\u00f8");
+	context->Update();
+	context->Render();
+
+	CHECK(GetFontEngineInterface()->GetVersion(handle) == version);
+	CHECK(render_interface.num_update_texture == 3);
+	CHECK(render_interface.num_generate_texture == num_generated);
+
+	// When the render interface can't update textures, the layers are regenerated instead.
+	render_interface.support_updates = false;
+	document->SetInnerRML(u8"abc\u00e9\u00e5\u00f8\u00e6");
+	context->Update();
+	context->Render();
+
+	CHECK(GetFontEngineInterface()->GetVersion(handle) == version + 1);
+	CHECK(render_interface.num_generate_texture > num_generated);
+
+	Rml::RemoveContext("glyphs");
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.string_width_cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	int hits_begin = 0, misses_begin = 0;
+	GetStringWidthCacheStatistics(hits_begin, misses_begin);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; font-size: 15px; width: 300px; }
+	</style>
+</head>
+<body>The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog.</body>
+</rml>
+)");
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	int hits_layout = 0, misses_layout = 0;
+	GetStringWidthCacheStatistics(hits_layout, misses_layout);
+
+	// The repeated sentence is measured from the cache.
+	CHECK(misses_layout > misses_begin);
+	CHECK(hits_layout > hits_begin);
+
+	// Breaking the lines at a different width may measure the words at the start of new lines without kerning.
+	document->SetProperty("width", "200px");
+	context->Update();
+
+	GetStringWidthCacheStatistics(hits_layout, misses_layout);
+
+	// Returning to a previous width re-uses all the measured words.
+	document->SetProperty("width", "300px");
+	context->Update();
+
+	int hits_relayout = 0, misses_relayout = 0;
+	GetStringWidthCacheStatistics(hits_relayout, misses_relayout);
+
+	CHECK(misses_relayout == misses_layout);
+	CHECK(hits_relayout > hits_layout);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,905 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/DataModelHandle.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementText.h>
+#include <RmlUi/Core/RenderInterface.h>
+#include <RmlUi/Core/StringUtilities.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+namespace {
+
+struct Entry {
+	String name;
+	int score = 0;
+	Vector<String> tags;
+};
+
+static const String document_for_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+<body>
+<div id="list" data-model="entries">
+	<p data-for="entry : entries" class="entry" data-class-first="it_index == 0">
+		<span style="color: red;">{{ it_index }}: {{ entry.name }}</span>
+		<em data-if="entry.score > 5">{{ entry.score < 10 ? 'low' : 'high' }}</em>
+		<i data-for="tag : entry.tags">{{ tag }}</i>
+		Score {{ entry.score }}
+	</p>
+</div>
+</body>
+</rml>
+)";
+
+struct Item {
+	String name;
+	int count = 0;
+};
+
+static const String document_dirty_address_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+<body>
+<div id="list" data-model="items">
+	<p data-for="item : items" data-event-click="item.count = item.count + 1">{{ item.name }}: {{ item.count | counted }}</p>
+	<span id="size">{{ items.size }}</span>
+</div>
+</body>
+</rml>
+)";
+
+static const String document_virtual_for_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+		#list { display: block; height: 100px; overflow: auto; }
+		#list div { margin: 13px; padding: 5px; border: 3px #000; height: 50px; }
+		p { display: block; height: 20px; }
+	</style>
+</head>
+<body>
+<div data-model="virtual">
+	<div id="list">
+		<p data-virtualfor="value : values">{{ value }}</p>
+	</div>
+</div>
+</body>
+</rml>
+)";
+
+struct Task {
+	int id = 0;
+	String name;
+};
+
+static const String document_keyed_for_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+<body>
+<div id="list" data-model="tasks">
+	<p data-for="task : tasks" data-key="task.id"><span>{{ it_index }}: {{ task.name }}</span><input type="text" data-value="task.name"/></p>
+</div>
+</body>
+</rml>
+)";
+
+struct TaskGroup {
+	int id = 0;
+	Vector<Task> tasks;
+};
+
+static const String document_nested_keyed_for_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+<body>
+<div id="list" data-model="groups">
+	<div data-for="group, group_index : groups" data-key="group.id">
+		<p data-for="task, task_index : group.tasks" data-key="task.id">{{ group_index }}.{{ task_index }}: {{ task.name }}</p>
+	</div>
+</div>
+</body>
+</rml>
+)";
+
+struct Player {
+	String name;
+	int level = 0;
+};
+
+static const String document_pure_transform_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+<body>
+<div data-model="player">
+	<p id="name">{{ 'name' | localize }}: {{ player.name }}</p>
+	<p id="level">{{ 'level' | localize(player.level) }}</p>
+	<p id="upper">{{ player.name | counted_upper }}</p>
+</div>
+</body>
+</rml>
+)";
+
+static const String document_no_op_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+<body>
+<div data-model="hud">
+	<p data-style-width="width" data-attr-title="title" data-class-active="active">Health {{ title }}</p>
+</div>
+</body>
+</rml>
+)";
+
+// The word width cache is queried for every word laid out, which tells us whether the document was formatted.
+static int GetNumMeasuredWords()
+{
+	int num_hits = 0, num_misses = 0;
+	GetStringWidthCacheStatistics(num_hits, num_misses);
+	return num_hits + num_misses;
+}
+
+} // namespace
+
+TEST_CASE("databinding.for_template")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<Entry> entries = {
+		{ "Alice", 12, { "a", "b" } },
+		{ "Bob", 7, {} },
+		{ "Carol", 3, { "c" } },
+	};
+
+	{
+		DataModelConstructor constructor = context->CreateDataModel("entries");
+		REQUIRE(bool(constructor));
+		constructor.RegisterArray<Vector<String>>();
+		if (auto entry_handle = constructor.RegisterStruct<Entry>())
+		{
+			entry_handle.RegisterMember("name", &Entry::name);
+			entry_handle.RegisterMember("score", &Entry::score);
+			entry_handle.RegisterMember("tags", &Entry::tags);
+		}
+		constructor.RegisterArray<Vector<Entry>>();
+		constructor.Bind("entries", &entries);
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_for_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	// The rows are generated before the 'data-for' element itself.
+	Element* list = document->GetElementById("list");
+	REQUIRE(list->GetNumChildren() == 4);
+
+	Element* row = list->GetChild(0);
+	CHECK(row->IsClassSet("first"));
+	CHECK(row->GetChild(0)->GetInnerRML() == "0: Alice");
+	Colourb color = row->GetChild(0)->GetComputedValues().color;
+	CHECK((color == Colourb(255, 0, 0)));
+	CHECK(row->GetChild(1)->GetInnerRML() == "high");
+
+	ElementList tags;
+	row->GetElementsByTagName(tags, "i");
+	REQUIRE(tags.size() == 3);
+	CHECK(tags[0]->GetInnerRML() == "a");
+	CHECK(tags[1]->GetInnerRML() == "b");
+
+	row = list->GetChild(2);
+	CHECK_FALSE(row->IsClassSet("first"));
+	CHECK(row->GetChild(0)->GetInnerRML() == "2: Carol");
+	CHECK(row->GetChild(1)->GetInnerRML() == "low");
+	CHECK(row->GetChild(1)->IsVisible() == false);
+	CHECK(row->GetInnerRML().find("Score 3") != String::npos);
+
+	// Rows added later are generated from the same template.
+	entries.push_back({ "Dave", 9, { "d", "e", "f" } });
+	context->GetDataModel("entries").GetModelHandle().DirtyVariable("entries");
+	context->Update();
+
+	REQUIRE(list->GetNumChildren() == 5);
+	row = list->GetChild(3);
+	CHECK(row->GetChild(0)->GetInnerRML() == "3: Dave");
+	CHECK(row->GetChild(1)->GetInnerRML() == "low");
+	tags.clear();
+	row->GetElementsByTagName(tags, "i");
+	CHECK(tags.size() == 4);
+
+	document->Close();
+	context->RemoveDataModel("entries");
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("databinding.dirty_address")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<Item> items = { { "a", 0 }, { "b", 0 }, { "c", 0 }, { "d", 0 }, { "e", 0 } };
+	int num_evaluations = 0;
+
+	DataModelHandle handle;
+	{
+		DataModelConstructor constructor = context->CreateDataModel("items");
+		REQUIRE(bool(constructor));
+		if (auto item_handle = constructor.RegisterStruct<Item>())
+		{
+			item_handle.RegisterMember("name", &Item::name);
+			item_handle.RegisterMember("count", &Item::count);
+		}
+		constructor.RegisterArray<Vector<Item>>();
+		constructor.Bind("items", &items);
+		constructor.RegisterTransformFunc("counted", [&](Variant&, const VariantList&) {
+			num_evaluations += 1;
+			return true;
+		});
+		handle = constructor.GetModelHandle();
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_dirty_address_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* list = document->GetElementById("list");
+	REQUIRE(list->GetNumChildren() == 7);
+	CHECK(num_evaluations == 5);
+
+	// Only the views reading from the given array element are updated.
+	num_evaluations = 0;
+	items[2].count = 10;
+	handle.DirtyAddress("items[2].count");
+	CHECK(handle.IsVariableDirty("items"));
+	context->Update();
+	CHECK(num_evaluations == 1);
+	CHECK(list->GetChild(2)->GetInnerRML() == "c: 10");
+
+	num_evaluations = 0;
+	handle.DirtyArrayRange("items", 1, 3);
+	context->Update();
+	CHECK(num_evaluations == 2);
+
+	// Assignments from event expressions dirty only the array element assigned to.
+	num_evaluations = 0;
+	list->GetChild(4)->Click();
+	context->Update();
+	CHECK(num_evaluations == 1);
+	CHECK(items[4].count == 1);
+	CHECK(list->GetChild(4)->GetInnerRML() == "e: 1");
+
+	// Dirtying the whole variable updates all views.
+	num_evaluations = 0;
+	items.push_back({ "f", 0 });
+	handle.DirtyVariable("items");
+	context->Update();
+	CHECK(num_evaluations == 6);
+	CHECK(document->GetElementById("size")->GetInnerRML() == "6");
+
+	document->Close();
+	context->RemoveDataModel("items");
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("databinding.virtual_for")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<int> values(1000);
+	for (int i = 0; i < (int)values.size(); i++)
+		values[i] = i;
+
+	DataModelHandle handle;
+	{
+		DataModelConstructor constructor = context->CreateDataModel("virtual");
+		REQUIRE(bool(constructor));
+		constructor.RegisterArray<Vector<int>>();
+		constructor.Bind("values", &values);
+		handle = constructor.GetModelHandle();
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_virtual_for_rml);
+	REQUIRE(document);
+	document->Show();
+
+	// The entry height is measured after the first entries are formatted.
+	for (int i = 0; i < 3; i++)
+		context->Update();
+
+	Element* list = document->GetElementById("list");
+
+	auto get_rows = [&]() {
+		ElementList rows;
+		list->GetElementsByTagName(rows, "p");
+		rows.pop_back();
+		return rows;
+	};
+
+	ElementList rows = get_rows();
+	REQUIRE(!rows.empty());
+	CHECK(rows.size() < 20);
+	CHECK(rows.front()->GetInnerRML() == "0");
+	CHECK(list->GetScrollHeight() == doctest::Approx(20.f * values.size()));
+
+	// Scrolling instances the entries in the new viewport.
+	list->SetScrollTop(5000.f);
+	context->Update();
+
+	rows = get_rows();
+	REQUIRE(!rows.empty());
+	CHECK(rows.size() < 20);
+	CHECK(FromString<int>(rows.front()->GetInnerRML(), -1) <= 250);
+	CHECK(FromString<int>(rows.back()->GetInnerRML(), -1) >= 255);
+	CHECK(rows.front()->GetAbsoluteOffset().y <= list->GetAbsoluteOffset().y);
+	CHECK(list->GetScrollHeight() == doctest::Approx(20.f * values.size()));
+
+	// Removing entries shrinks the scrollable area.
+	values.resize(100);
+	handle.DirtyVariable("values");
+	context->Update();
+	context->Update();
+
+	rows = get_rows();
+	REQUIRE(!rows.empty());
+	CHECK(rows.size() < 20);
+	CHECK(rows.back()->GetInnerRML() == "99");
+	CHECK(list->GetScrollHeight() == doctest::Approx(20.f * values.size()));
+
+	// The spacers are not styled by the document, and are removed together with the view.
+	auto count_spacers = [&]() {
+		int num_spacers = 0;
+		for (int i = 0; i < list->GetNumChildren(); i++)
+			num_spacers += int(list->GetChild(i)->GetTagName() == "#spacer");
+		return num_spacers;
+	};
+	CHECK(count_spacers() == 2);
+
+	list->RemoveChild(list->GetLastChild());
+	context->Update();
+	CHECK(count_spacers() == 0);
+
+	document->Close();
+	context->RemoveDataModel("virtual");
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("databinding.keyed_for")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<Task> tasks = { { 1, "a" }, { 2, "b" }, { 3, "c" } };
+
+	DataModelHandle handle;
+	{
+		DataModelConstructor constructor = context->CreateDataModel("tasks");
+		REQUIRE(bool(constructor));
+		if (auto task_handle = constructor.RegisterStruct<Task>())
+		{
+			task_handle.RegisterMember("id", &Task::id);
+			task_handle.RegisterMember("name", &Task::name);
+		}
+		constructor.RegisterArray<Vector<Task>>();
+		constructor.Bind("tasks", &tasks);
+		handle = constructor.GetModelHandle();
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_keyed_for_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* list = document->GetElementById("list");
+	REQUIRE(list->GetNumChildren() == 4);
+
+	auto get_rows = [&]() {
+		ElementList rows;
+		for (int i = 0; i < list->GetNumChildren() - 1; i++)
+			rows.push_back(list->GetChild(i));
+		return rows;
+	};
+	auto get_text = [](Element* row) { return row->GetChild(0)->GetInnerRML(); };
+
+	const ElementList initial_rows = get_rows();
+	CHECK(get_text(initial_rows[0]) == "0: a");
+
+	// Inserting in front and reordering keeps the elements of the existing keys.
+	tasks = { { 4, "d" }, { 3, "c" }, { 1, "a" }, { 2, "b" } };
+	handle.DirtyVariable("tasks");
+	context->Update();
+
+	ElementList rows = get_rows();
+	REQUIRE(rows.size() == 4);
+	CHECK(rows[1] == initial_rows[2]);
+	CHECK(rows[2] == initial_rows[0]);
+	CHECK(rows[3] == initial_rows[1]);
+	CHECK(get_text(rows[0]) == "0: d");
+	CHECK(get_text(rows[1]) == "1: c");
+	CHECK(get_text(rows[2]) == "2: a");
+	CHECK(get_text(rows[3]) == "3: b");
+	CHECK(list->GetChild(4)->GetAttribute<String>("data-for", "") == "task : tasks");
+
+	// Controllers of moved entries assign to their new index.
+	Element* input = rows[2]->GetChild(1);
+	input->DispatchEvent(EventId::Change, Dictionary{ { "value", Variant("x") } });
+	context->Update();
+	CHECK(tasks[2].name == "x");
+	CHECK(get_text(rows[2]) == "2: x");
+
+	// Removed keys remove only their element.
+	tasks.erase(tasks.begin() + 1);
+	handle.DirtyVariable("tasks");
+	context->Update();
+
+	rows = get_rows();
+	REQUIRE(rows.size() == 3);
+	CHECK(rows[1] == initial_rows[0]);
+	CHECK(rows[2] == initial_rows[1]);
+	CHECK(get_text(rows[1]) == "1: x");
+	CHECK(get_text(rows[2]) == "2: b");
+
+	document->Close();
+	context->RemoveDataModel("tasks");
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("databinding.nested_keyed_for")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<TaskGroup> groups = { { 1, { { 1, "a" }, { 2, "b" } } }, { 2, { { 3, "c" }, { 4, "d" } } } };
+
+	DataModelHandle handle;
+	{
+		DataModelConstructor constructor = context->CreateDataModel("groups");
+		REQUIRE(bool(constructor));
+		if (auto task_handle = constructor.RegisterStruct<Task>())
+		{
+			task_handle.RegisterMember("id", &Task::id);
+			task_handle.RegisterMember("name", &Task::name);
+		}
+		constructor.RegisterArray<Vector<Task>>();
+		if (auto group_handle = constructor.RegisterStruct<TaskGroup>())
+		{
+			group_handle.RegisterMember("id", &TaskGroup::id);
+			group_handle.RegisterMember("tasks", &TaskGroup::tasks);
+		}
+		constructor.RegisterArray<Vector<TaskGroup>>();
+		constructor.Bind("groups", &groups);
+		handle = constructor.GetModelHandle();
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_nested_keyed_for_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* list = document->GetElementById("list");
+
+	auto get_texts = [&]() {
+		StringList texts;
+		for (int i = 0; i < list->GetNumChildren() - 1; i++)
+		{
+			Element* group = list->GetChild(i);
+			for (int j = 0; j < group->GetNumChildren() - 1; j++)
+				texts.push_back(group->GetChild(j)->GetInnerRML());
+		}
+		return texts;
+	};
+
+	CHECK(get_texts() == StringList{ "0.0: a", "0.1: b", "1.0: c", "1.1: d" });
+
+	// Moving the outer rows only changes the outer index, even where it equals the index of a nested row.
+	Element* second_group = list->GetChild(1);
+	std::swap(groups[0], groups[1]);
+	handle.DirtyVariable("groups");
+	context->Update();
+
+	CHECK(list->GetChild(0) == second_group);
+	CHECK(get_texts() == StringList{ "0.0: c", "0.1: d", "1.0: a", "1.1: b" });
+
+	// Moving the nested rows leaves the outer index alone.
+	std::swap(groups[1].tasks[0], groups[1].tasks[1]);
+	handle.DirtyVariable("groups");
+	context->Update();
+
+	CHECK(get_texts() == StringList{ "0.0: c", "0.1: d", "1.0: b", "1.1: a" });
+
+	document->Close();
+	context->RemoveDataModel("groups");
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("databinding.pure_transform")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Player player = { "alice", 3 };
+	int num_localize_calls = 0;
+	int num_upper_calls = 0;
+
+	DataModelHandle handle;
+	{
+		DataModelConstructor constructor = context->CreateDataModel("player");
+		REQUIRE(bool(constructor));
+		if (auto player_handle = constructor.RegisterStruct<Player>())
+		{
+			player_handle.RegisterMember("name", &Player::name);
+			player_handle.RegisterMember("level", &Player::level);
+		}
+		constructor.Bind("player", &player);
+		constructor.RegisterTransformFunc("localize", [&](Variant& variant, const VariantList& arguments) {
+			num_localize_calls += 1;
+			String result = StringUtilities::ToUpper(variant.Get<String>());
+			if (!arguments.empty())
+				result += " " + arguments[0].Get<String>();
+			variant = result;
+			return true;
+		}, true);
+		constructor.RegisterTransformFunc("counted_upper", [&](Variant& variant, const VariantList&) {
+			num_upper_calls += 1;
+			variant = StringUtilities::ToUpper(variant.Get<String>());
+			return true;
+		});
+		handle = constructor.GetModelHandle();
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_pure_transform_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	CHECK(document->GetElementById("name")->GetInnerRML() == "NAME: alice");
+	CHECK(document->GetElementById("level")->GetInnerRML() == "LEVEL 3");
+	CHECK(num_localize_calls == 2);
+	CHECK(num_upper_calls == 1);
+
+	// Pure transform functions are only called again when their input or arguments change.
+	player.name = "bob";
+	handle.DirtyVariable("player");
+	context->Update();
+
+	CHECK(document->GetElementById("name")->GetInnerRML() == "NAME: bob");
+	CHECK(document->GetElementById("upper")->GetInnerRML() == "BOB");
+	CHECK(num_localize_calls == 2);
+	CHECK(num_upper_calls == 2);
+
+	player.level = 4;
+	handle.DirtyVariable("player");
+	context->Update();
+
+	CHECK(document->GetElementById("level")->GetInnerRML() == "LEVEL 4");
+	CHECK(num_localize_calls == 3);
+	CHECK(num_upper_calls == 3);
+
+	document->Close();
+	context->RemoveDataModel("player");
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("databinding.no_op_update")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	String width = "100px";
+	String title = "bar";
+	bool active = true;
+
+	DataModelHandle handle;
+	{
+		DataModelConstructor constructor = context->CreateDataModel("hud");
+		REQUIRE(bool(constructor));
+		constructor.Bind("width", &width);
+		constructor.Bind("title", &title);
+		constructor.Bind("active", &active);
+		handle = constructor.GetModelHandle();
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_no_op_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+	context->Update();
+
+	// Refreshing unchanged values does not dirty the layout.
+	int num_words = GetNumMeasuredWords();
+	handle.DirtyVariable("width");
+	handle.DirtyVariable("title");
+	handle.DirtyVariable("active");
+	context->Update();
+	CHECK(GetNumMeasuredWords() == num_words);
+
+	width = "120px";
+	handle.DirtyVariable("width");
+	context->Update();
+	CHECK(GetNumMeasuredWords() > num_words);
+
+	document->Close();
+	context->RemoveDataModel("hud");
+	TestsShell::ShutdownShell();
+}
+
+static const String document_text_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+<body>
+<p id="text" data-model="text">{{ value }}</p>
+</body>
+</rml>
+)";
+
+class TextRenderInterface : public RenderInterface {
+public:
+	void RenderGeometry(Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, TextureHandle /*texture*/, const Vector2f& /*translation*/) override {}
+
+	CompiledGeometryHandle CompileGeometry(Vertex* /*vertices*/, int num_vertices, int* /*indices*/, int /*num_indices*/, TextureHandle /*texture*/) override
+	{
+		num_compiled += 1;
+		num_compiled_vertices += num_vertices;
+		return CompiledGeometryHandle(num_compiled);
+	}
+	void RenderCompiledGeometry(CompiledGeometryHandle /*geometry*/, const Vector2f& /*translation*/) override {}
+	void ReleaseCompiledGeometry(CompiledGeometryHandle /*geometry*/) override {}
+
+	bool GenerateTexture(TextureHandle& texture_handle, const byte* /*source*/, const Vector2i& /*source_dimensions*/) override
+	{
+		texture_handle = 1;
+		return true;
+	}
+
+	void EnableScissorRegion(bool /*enable*/) override {}
+	void SetScissorRegion(int /*x*/, int /*y*/, int /*width*/, int /*height*/) override {}
+
+	int num_compiled = 0;
+	int num_compiled_vertices = 0;
+};
+
+TEST_CASE("databinding.text_view")
+{
+	TestsShell::GetContext();
+
+	TextRenderInterface render_interface;
+	Context* context = Rml::CreateContext("text", Vector2i(1000, 800), &render_interface);
+	REQUIRE(context);
+
+	String value = "Hello world";
+
+	DataModelHandle handle;
+	{
+		DataModelConstructor constructor = context->CreateDataModel("text");
+		REQUIRE(bool(constructor));
+		constructor.Bind("value", &value);
+		handle = constructor.GetModelHandle();
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_text_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* paragraph = document->GetElementById("text");
+	REQUIRE(paragraph->GetNumChildren() == 1);
+	ElementText* text = rmlui_dynamic_cast<ElementText*>(paragraph->GetChild(0));
+	REQUIRE(text);
+
+	// Updates and renders the context, returning the number of text vertices compiled during the render.
+	auto render = [&]() {
+		context->Update();
+		render_interface.num_compiled_vertices = 0;
+		context->Render();
+		return render_interface.num_compiled_vertices;
+	};
+
+	const int num_vertices_initial = render();
+	CHECK(text->GetText() == "Hello world");
+	CHECK(num_vertices_initial > 0);
+
+	// A value of the same length regenerates the geometry.
+	value = "Hello World";
+	handle.DirtyVariable("value");
+	int num_compiled = render_interface.num_compiled;
+	const int num_vertices_same_length = render();
+	CHECK(text->GetText() == "Hello World");
+	CHECK(render_interface.num_compiled > num_compiled);
+	CHECK(num_vertices_same_length == num_vertices_initial);
+
+	// A shorter value generates less geometry.
+	value = "Hi";
+	handle.DirtyVariable("value");
+	num_compiled = render_interface.num_compiled;
+	const int num_vertices_shorter = render();
+	CHECK(text->GetText() == "Hi");
+	CHECK(render_interface.num_compiled > num_compiled);
+	CHECK(num_vertices_shorter > 0);
+	CHECK(num_vertices_shorter < num_vertices_same_length);
+
+	// An unchanged value does not dirty the text.
+	handle.DirtyVariable("value");
+	num_compiled = render_interface.num_compiled;
+	CHECK(render() == 0);
+	CHECK(text->GetText() == "Hi");
+	CHECK(render_interface.num_compiled == num_compiled);
+
+	// A longer value again.
+	value = "Hello again, world";
+	handle.DirtyVariable("value");
+	CHECK(render() > num_vertices_initial);
+	CHECK(text->GetText() == "Hello again, world");
+	CHECK(paragraph->GetInnerRML() == "Hello again, world");
+
+	document->Close();
+	context->RemoveDataModel("text");
+	Rml::RemoveContext("text");
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("databinding.update_budget")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<int> values(20, 1);
+
+	DataModelHandle handle;
+	{
+		DataModelConstructor constructor = context->CreateDataModel("virtual");
+		REQUIRE(bool(constructor));
+		constructor.RegisterArray<Vector<int>>();
+		constructor.Bind("values", &values);
+		handle = constructor.GetModelHandle();
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_virtual_for_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	// With a tiny budget, only the views updated before the deadline is noticed are processed.
+	context->SetDataModelUpdateBudget(1e-9);
+	for (int& value : values)
+		value = 2;
+	handle.DirtyVariable("values");
+	context->Update();
+
+	const DataModelStatistics& statistics = handle.GetStatistics();
+	CHECK(statistics.num_views_updated >= 1);
+	CHECK(statistics.num_views_deferred > 0);
+	CHECK(statistics.update_time >= 0.0);
+
+	// Views are deferred at most once.
+	const int num_deferred = statistics.num_views_deferred;
+	context->Update();
+	CHECK(statistics.num_views_updated == num_deferred);
+	CHECK(statistics.num_views_deferred == 0);
+
+	ElementList rows;
+	document->GetElementById("list")->GetElementsByTagName(rows, "p");
+	rows.pop_back();
+	REQUIRE(!rows.empty());
+	for (Element* row : rows)
+		CHECK(row->GetInnerRML() == "2");
+
+	context->SetDataModelUpdateBudget(0);
+	document->Close();
+	context->RemoveDataModel("virtual");
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("databinding.update_budget_new_views")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<Entry> entries = { { "Alice", 12, { "a" } } };
+
+	DataModelHandle handle;
+	{
+		DataModelConstructor constructor = context->CreateDataModel("entries");
+		REQUIRE(bool(constructor));
+		constructor.RegisterArray<Vector<String>>();
+		if (auto entry_handle = constructor.RegisterStruct<Entry>())
+		{
+			entry_handle.RegisterMember("name", &Entry::name);
+			entry_handle.RegisterMember("score", &Entry::score);
+			entry_handle.RegisterMember("tags", &Entry::tags);
+		}
+		constructor.RegisterArray<Vector<Entry>>();
+		constructor.Bind("entries", &entries);
+		handle = constructor.GetModelHandle();
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_for_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	// Rows created while the budget is exceeded still have all of their views updated.
+	context->SetDataModelUpdateBudget(1e-9);
+	for (int i = 0; i < 20; i++)
+		entries.push_back({ "Entry" + ToString(i), i, { "x", "y" } });
+	handle.DirtyVariable("entries");
+	context->Update();
+
+	Element* list = document->GetElementById("list");
+	REQUIRE(list->GetNumChildren() == 22);
+	CHECK(list->GetInnerRML().find("{{") == String::npos);
+	CHECK(list->GetChild(20)->GetChild(0)->GetInnerRML() == "20: Entry19");
+
+	context->SetDataModelUpdateBudget(0);
+	document->Close();
+	context->RemoveDataModel("entries");
+	TestsShell::ShutdownShell();
+}
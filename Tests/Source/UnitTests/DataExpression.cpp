@@ -51,8 +51,11 @@ static String TestExpression(const String& expression)
 	{
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
+		AccessorList accessors;
+		for (const DataAddress& address : addresses)
+			accessors.push_back(interface.GetAccessor(address));
 
-		DataInterpreter interpreter(program, addresses, interface);
+		DataInterpreter interpreter(program, addresses, interface, &accessors);
 
 		if (interpreter.Run())
 			result = interpreter.Result().Get<String>();
@@ -75,8 +78,11 @@ static bool TestAssignment(const String& expression)
 	{
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
+		AccessorList accessors;
+		for (const DataAddress& address : addresses)
+			accessors.push_back(interface.GetAccessor(address));
 
-		DataInterpreter interpreter(program, addresses, interface);
+		DataInterpreter interpreter(program, addresses, interface, &accessors);
 		if (interpreter.Run())
 			result = true;
 		else
@@ -90,6 +96,13 @@ static bool TestAssignment(const String& expression)
 }
 
 
+static size_t ProgramSize(const String& expression)
+{
+	DataParser parser(expression, interface);
+	if (!parser.Parse(false))
+		return 0;
+	return parser.ReleaseProgram().size();
+}
 
 TEST_CASE("Data expressions")
 {
@@ -149,4 +162,39 @@ TEST_CASE("Data expressions")
 	CHECK(TestExpression("(3.42345 | format(0)) + 0.2") == "30.2"); // Here, format(0) returns a string, so the + means string concatenation.
 }
 
+TEST_CASE("Data expressions optimized")
+{
+	struct Unit {
+		int hp = 75;
+		int max_hp = 120;
+	};
+	Unit unit;
+	Vector<Unit> units(2);
+
+	DataModelConstructor handle(&model, &type_register);
+	if (auto unit_handle = handle.RegisterStruct<Unit>())
+	{
+		unit_handle.RegisterMember("hp", &Unit::hp);
+		unit_handle.RegisterMember("max_hp", &Unit::max_hp);
+	}
+	handle.RegisterArray<Vector<Unit>>();
+	handle.Bind("unit", &unit);
+	handle.Bind("units", &units);
+
+	// Operations on literals are evaluated during parsing.
+	CHECK(ProgramSize("2 * (3 + 4) - 1") == 1);
+	CHECK(ProgramSize("!(1 < 2) ? 'a' + 'b' : 'c'") < 10);
+	CHECK(TestExpression("2 * (3 + 4) - 1") == "13");
+
+	// Single operands are passed through registers instead of the stack.
+	CHECK(ProgramSize("unit.hp / unit.max_hp * 100") == 7);
+	CHECK(TestExpression("unit.hp / unit.max_hp * 100") == "62.5");
+
+	// Struct members are resolved once, array entries are looked up on every run.
+	CHECK(TestExpression("unit.hp + units[1].hp + units.size") == "152");
+	units.resize(5);
+	units[1].hp = 5;
+	CHECK(TestExpression("unit.hp + units[1].hp + units.size") == "85");
+}
+
 
@@ -30,6 +30,9 @@
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/EventListener.h>
+#include <RmlUi/Core/SystemInterface.h>
 #include <doctest.h>
 
 using namespace Rml;
@@ -103,3 +106,180 @@ TEST_CASE("element.clone")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_update_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+		div { color: #f00; }
+		div.blue { color: #00f; }
+		.blue p { color: #0f0; }
+		@keyframes fade { from { opacity: 1; } to { opacity: 0; } }
+		.fade { animation: 0.05s fade; }
+	</style>
+</head>
+
+<body>
+<div id="outer"><div><div><p id="inner">Text</p></div></div></div>
+<div id="static"><p>Text</p></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("element.update_dirty_subtrees")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_update_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	Element* outer = document->GetElementById("outer");
+	Element* inner = document->GetElementById("inner");
+	REQUIRE(outer);
+	REQUIRE(inner);
+
+	CHECK(outer->GetComputedValues().color.red == 255);
+	CHECK(inner->GetComputedValues().color.red == 255);
+
+	// Changing a class must reach descendants depending on it, even though the rest of the document is clean.
+	outer->SetClass("blue", true);
+	context->Update();
+	CHECK(outer->GetComputedValues().color.blue == 255);
+	CHECK(inner->GetComputedValues().color.green == 255);
+
+	outer->SetClass("blue", false);
+	context->Update();
+	CHECK(inner->GetComputedValues().color.red == 255);
+	CHECK(inner->GetComputedValues().color.green == 0);
+
+	// Animations must keep advancing without any other changes to the element.
+	inner->SetClass("fade", true);
+	context->Update();
+	const float initial_opacity = inner->GetComputedValues().opacity;
+
+	const double t_start = GetSystemInterface()->GetElapsedTime();
+	while (GetSystemInterface()->GetElapsedTime() - t_start < 0.1)
+		context->Update();
+
+	CHECK(initial_opacity > 0.5f);
+	CHECK(inner->GetComputedValues().opacity == 1.f);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+class RecordingEventListener : public EventListener {
+public:
+	RecordingEventListener(String name, Vector<String>& log) : name(std::move(name)), log(log) {}
+
+	void ProcessEvent(Event& event) override
+	{
+		const int phase = (int)event.GetPhase();
+		log.push_back(name + ":" + ToString(phase) + ":" + event.GetParameter<String>("value", ""));
+
+		// Dispatch a nested event while the outer event is in flight.
+		if (nested_target)
+		{
+			Element* target = nested_target;
+			nested_target = nullptr;
+			target->DispatchEvent("nested", Dictionary{{"value", Variant("inner")}});
+		}
+	}
+
+	String name;
+	Vector<String>& log;
+	Element* nested_target = nullptr;
+};
+
+TEST_CASE("element.event_dispatch_order")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(R"(<rml><body><div id="outer"><div id="inner"/></div></body></rml>)");
+	REQUIRE(document);
+
+	Element* outer = document->GetElementById("outer");
+	Element* inner = document->GetElementById("inner");
+	REQUIRE(outer);
+	REQUIRE(inner);
+
+	Vector<String> log;
+	RecordingEventListener outer_capture("outer_capture", log);
+	RecordingEventListener outer_bubble("outer_bubble", log);
+	RecordingEventListener inner_first("inner_first", log);
+	RecordingEventListener inner_second("inner_second", log);
+	RecordingEventListener nested("nested", log);
+
+	outer->AddEventListener("custom", &outer_bubble);
+	outer->AddEventListener("custom", &outer_capture, true);
+	inner->AddEventListener("custom", &inner_first);
+	inner->AddEventListener("custom", &inner_second, true);
+	outer->AddEventListener("nested", &nested);
+
+	// Capture runs from the root down, then the target in order of insertion, then bubbling up.
+	inner_first.nested_target = inner;
+	inner->DispatchEvent("custom", Dictionary{{"value", Variant("outer")}});
+
+	const Vector<String> expected = {
+		"outer_capture:1:outer",
+		"inner_first:2:outer",
+		"nested:4:inner",
+		"inner_second:2:outer",
+		"outer_bubble:4:outer",
+	};
+	CHECK(log == expected);
+
+	// Reused events must not carry over any parameters or state from previous dispatches.
+	log.clear();
+	inner->DispatchEvent("custom", Dictionary{});
+	CHECK(log.size() == 4);
+	CHECK(log.back() == "outer_bubble:4:");
+
+	outer->RemoveEventListener("custom", &outer_bubble);
+	outer->RemoveEventListener("custom", &outer_capture, true);
+	inner->RemoveEventListener("custom", &inner_first);
+	inner->RemoveEventListener("custom", &inner_second, true);
+	outer->RemoveEventListener("nested", &nested);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("element.set_unchanged_attribute")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_update_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* element = document->AppendChild(document->CreateElement("div"));
+	element->SetAttribute("style", "width: 10px;");
+	context->Update();
+	CHECK(element->GetProperty<float>("width") == 10.f);
+
+	// Setting the style attribute to its current value resets the local properties set since.
+	element->SetProperty("width", "20px");
+	context->Update();
+	CHECK(element->GetProperty<float>("width") == 20.f);
+
+	element->SetAttribute("style", "width: 10px;");
+	context->Update();
+	CHECK(element->GetProperty<float>("width") == 10.f);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
@@ -28,6 +28,7 @@
 
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
 #include <doctest.h>
@@ -233,3 +234,93 @@ TEST_CASE("elementdocument.focus")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_layout_boundary_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; font-size: 15px; width: 400px; }
+		#boundary { position: relative; width: 200px; height: 100px; overflow: hidden; }
+		#boundary.visible { overflow: visible; }
+		#absolute { position: absolute; right: 0; bottom: 0; width: 20px; height: 20px; }
+	</style>
+</head>
+<body>
+<p>Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.</p>
+<div id="boundary">
+	<span id="label">1</span>
+	<div id="inner">Ut enim ad minim veniam</div>
+	<div id="absolute"/>
+</div>
+<p id="after">Duis aute irure dolor in reprehenderit in voluptate velit esse cillum dolore eu fugiat nulla pariatur.</p>
+</body>
+</rml>
+)";
+
+// The word width cache is queried for every word laid out, which tells us how much of the document was formatted.
+static int GetNumMeasuredWords()
+{
+	int num_hits = 0, num_misses = 0;
+	GetStringWidthCacheStatistics(num_hits, num_misses);
+	return num_hits + num_misses;
+}
+
+TEST_CASE("elementdocument.layout_boundary")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_layout_boundary_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* boundary = document->GetElementById("boundary");
+	Element* label = document->GetElementById("label");
+	Element* inner = document->GetElementById("inner");
+	Element* absolute = document->GetElementById("absolute");
+	Element* after = document->GetElementById("after");
+
+	struct Layout {
+		Vector2f label, inner, absolute, after;
+		bool operator==(const Layout& other) const {
+			return label == other.label && inner == other.inner && absolute == other.absolute && after == other.after;
+		}
+	};
+	auto get_layout = [&]() {
+		return Layout{ label->GetAbsoluteOffset(), inner->GetAbsoluteOffset(), absolute->GetAbsoluteOffset(), after->GetAbsoluteOffset() };
+	};
+
+	// Only the contents of the boundary are formatted when the label changes.
+	int num_words = GetNumMeasuredWords();
+	label->SetInnerRML("22 33 44 55 66 77 88 99 111 222 333 444 555 666 777 888 999 1111 2222 3333 4444");
+	context->Update();
+
+	const int num_words_boundary = GetNumMeasuredWords() - num_words;
+	CHECK(num_words_boundary > 0);
+
+	const Layout boundary_layout = get_layout();
+	CHECK(inner->GetAbsoluteOffset().y > boundary->GetAbsoluteOffset().y + label->GetBox().GetSize().y);
+
+	// Formatting the whole document gives the same result, resizing the context dirties the layout of all documents.
+	const Vector2i dimensions = context->GetDimensions();
+	num_words = GetNumMeasuredWords();
+	context->SetDimensions(dimensions + Vector2i(1, 0));
+	context->Update();
+	context->SetDimensions(dimensions);
+	const int num_words_document = GetNumMeasuredWords() - num_words;
+	CHECK(num_words_boundary * 2 < num_words_document);
+	CHECK(get_layout() == boundary_layout);
+
+	// Without a clipped overflow, the contents may affect the rest of the document.
+	boundary->SetClass("visible", true);
+	context->Update();
+	num_words = GetNumMeasuredWords();
+	label->SetInnerRML("1");
+	context->Update();
+	CHECK(GetNumMeasuredWords() - num_words > num_words_boundary);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
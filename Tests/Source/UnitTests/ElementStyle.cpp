@@ -85,3 +85,80 @@ TEST_CASE("elementstyle.inline_decorator_images")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_sharing_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+		p { color: #f00; }
+		p.blue { color: #00f; }
+		p#special { color: #0f0; }
+		div p:nth-child(3) { color: #ff0; }
+		span p:hover { color: #0ff; }
+	</style>
+</head>
+
+<body>
+<span>
+	<p/><p/><p class="blue"/><p/><p id="special"/><p/>
+</span>
+<div>
+	<p/><p/><p/><p/>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("elementstyle.definition_sharing")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_sharing_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+
+	auto get_colour = [](Element* element) {
+		const Colourb colour = element->GetProperty<Colourb>("color");
+		return String(colour.red ? "r" : "") + (colour.green ? "g" : "") + (colour.blue ? "b" : "");
+	};
+
+	auto get_colours = [&](Element* parent) {
+		String result;
+		for (int i = 0; i < parent->GetNumChildren(); i++)
+			result += get_colour(parent->GetChild(i)) + ";";
+		return result;
+	};
+
+	Element* span = document->GetChild(0);
+	Element* div = document->GetChild(1);
+	REQUIRE(span->GetNumChildren() == 6);
+	REQUIRE(div->GetNumChildren() == 4);
+
+	// Siblings with different classes or ids must not share definitions.
+	CHECK(get_colours(span) == "r;r;b;r;g;r;");
+
+	// Definitions depending on structural selectors are never shared.
+	CHECK(get_colours(div) == "r;r;rg;r;");
+
+	// Changing the pseudo classes of one sibling must not affect the others.
+	span->GetChild(1)->SetPseudoClass("hover", true);
+	context->Update();
+	CHECK(get_colours(span) == "r;gb;b;r;g;r;");
+
+	// Moving elements around must re-evaluate structural selectors.
+	div->RemoveChild(div->GetFirstChild());
+	span->RemoveChild(span->GetFirstChild());
+	context->Update();
+	CHECK(get_colours(div) == "r;r;rg;");
+	CHECK(get_colours(span) == "gb;b;r;g;r;");
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
@@ -104,6 +104,11 @@ static const Vector<QuerySelector> query_selectors =
 	{ "span:empty",                  "Y D0 D1 F0" },
 	{ ".hello.world, #P span, #I",   "Z D0 D1 F0 I" },
 	{ "body * span",                 "D0 D1 F0" },
+	{ ".parent .hello",              "H" },
+	{ ".world .hello",               "" },
+	{ "div.parent > p.hello",        "H" },
+	{ "#P #D span",                  "D0 D1" },
+	{ "body div#P.parent p span",    "D0 D1 F0" },
 };
 struct ClosestSelector {
 	String start_id;
@@ -239,3 +244,100 @@ TEST_CASE("Selectors")
 
 	Rml::Shutdown();
 }
+
+static const String doc_ancestor_filter_begin = R"(
+<rml>
+<head>
+	<title>Demo</title>
+	<style>
+		p { display: block; }
+		.outer p { color: #f00; }
+		.outer > p { background-color: #0f0; }
+		.absent p { color: #00f; }
+		.c1234 p { background-color: #ff0; }
+	</style>
+</head>
+<body>
+	<div id="outer" class="outer">
+		<div id="inner"><p id="deep"/></div>
+		<p id="child"/>
+	</div>
+	<div id="other"><p id="stray"/></div>
+)";
+static const String doc_ancestor_filter_end = R"(
+</body>
+</rml>
+)";
+
+TEST_CASE("Selectors.ancestor_filter")
+{
+	const Vector2i window_size(1024, 768);
+
+	TestsSystemInterface system_interface;
+	TestsRenderInterface render_interface;
+
+	SetRenderInterface(&render_interface);
+	SetSystemInterface(&system_interface);
+
+	Initialise();
+
+	Context* context = Rml::CreateContext("main", window_size);
+	REQUIRE(context);
+
+	// An ancestor with this many classes sets every bit of the ancestor filter, so that the filter accepts any selector
+	// and the ancestors have to be walked to reject it.
+	String crowded_classes;
+	for (int i = 0; i < 4000; i++)
+		crowded_classes += CreateString(16, "c%d ", i);
+
+	const String document_string =
+		doc_ancestor_filter_begin + "<div id=\"crowded\" class=\"" + crowded_classes + "\"><p id=\"crowded_p\"/></div>" + doc_ancestor_filter_end;
+	ElementDocument* document = context->LoadDocumentFromMemory(document_string);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	const Colourb red(255, 0, 0), green(0, 255, 0), blue(0, 0, 255), yellow(255, 255, 0);
+	auto colour_is = [&](const String& id, Colourb expected) {
+		Colourb colour = document->GetElementById(id)->GetComputedValues().color;
+		return colour == expected;
+	};
+	auto background_is = [&](const String& id, Colourb expected) {
+		Colourb colour = document->GetElementById(id)->GetComputedValues().background_color;
+		return colour == expected;
+	};
+
+	// Descendant and child rules, matched and rejected.
+	CHECK(colour_is("deep", red));
+	CHECK(colour_is("child", red));
+	CHECK_FALSE(colour_is("stray", red));
+	CHECK(background_is("child", green));
+	CHECK_FALSE(background_is("deep", green));
+
+	// Rejected by walking the ancestors after the filter gives a false positive.
+	CHECK_FALSE(colour_is("crowded_p", blue));
+	CHECK(background_is("crowded_p", yellow));
+
+	// The filter is rebuilt for each style resolution, thus changes to the ancestors are reflected.
+	document->GetElementById("outer")->SetClass("outer", false);
+	document->GetElementById("other")->SetClass("absent", true);
+	context->Update();
+
+	CHECK_FALSE(colour_is("deep", red));
+	CHECK_FALSE(background_is("child", green));
+	CHECK(colour_is("stray", blue));
+
+	Element* inner = document->GetElementById("inner");
+	ElementPtr stray = document->GetElementById("other")->RemoveChild(document->GetElementById("stray"));
+	document->GetElementById("outer")->SetClass("outer", true);
+	inner->AppendChild(std::move(stray));
+	context->Update();
+
+	CHECK(colour_is("stray", red));
+	CHECK_FALSE(background_is("stray", green));
+	CHECK(colour_is("deep", red));
+
+	context->UnloadDocument(document);
+
+	Rml::Shutdown();
+}